@@ -100,42 +100,49 @@ void ACharacterBase::ApplyDefaultEffects()
         return;
     }
 
+    // Effects of the previous level are replaced, not stacked
+    for (const FActiveGameplayEffectHandle& Handle : DefaultEffectHandles)
+    {
+        AbilitySystemComponent->RemoveActiveGameplayEffect(Handle);
+    }
+    DefaultEffectHandles.Reset();
+
+    auto ApplyEffect = [this](const TSubclassOf<UGameplayEffect>& EffectClass)
+    {
+        FGameplayEffectContextHandle ContextHandle = AbilitySystemComponent->MakeEffectContext();
+        ContextHandle.AddSourceObject(this);
+        
+        FGameplayEffectSpecHandle SpecHandle = AbilitySystemComponent->MakeOutgoingSpec(
+            EffectClass, CharacterLevel, ContextHandle
+        );
+        
+        if (SpecHandle.IsValid())
+        {
+            const FActiveGameplayEffectHandle Handle = AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+
+            // Instant effects leave no active handle behind
+            if (Handle.IsValid())
+            {
+                DefaultEffectHandles.Add(Handle);
+            }
+        }
+    };
+
     // Apply passive effects
     for (const TSubclassOf<UGameplayEffect>& EffectClass : DefaultPassiveEffects)
     {
         if (EffectClass)
         {
-            FGameplayEffectContextHandle ContextHandle = AbilitySystemComponent->MakeEffectContext();
-            ContextHandle.AddSourceObject(this);
-            
-            FGameplayEffectSpecHandle SpecHandle = AbilitySystemComponent->MakeOutgoingSpec(
-                EffectClass, CharacterLevel, ContextHandle
-            );
-            
-            if (SpecHandle.IsValid())
-            {
-                AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-            }
+            ApplyEffect(EffectClass);
         }
     }
 
     // Apply level-based effects
-    if (DefaultLevelEffects.Contains(CharacterLevel))
+    if (const TSubclassOf<UGameplayEffect>* LevelEffect = DefaultLevelEffects.Find(CharacterLevel))
     {
-        TSubclassOf<UGameplayEffect> LevelEffect = DefaultLevelEffects[CharacterLevel];
-        if (LevelEffect)
+        if (*LevelEffect)
         {
-            FGameplayEffectContextHandle ContextHandle = AbilitySystemComponent->MakeEffectContext();
-            ContextHandle.AddSourceObject(this);
-            
-            FGameplayEffectSpecHandle SpecHandle = AbilitySystemComponent->MakeOutgoingSpec(
-                LevelEffect, CharacterLevel, ContextHandle
-            );
-            
-            if (SpecHandle.IsValid())
-            {
-                AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-            }
+            ApplyEffect(*LevelEffect);
         }
     }
 }
@@ -11,11 +11,16 @@
 #include "YCR/Public/GAS/YCRAbilitySystemComponent.h"
 #include "YCR/Public/GAS/YCRAttributeSet.h"
 #include "Interfaces/IInteractableInterface.h"
+#include "Core/YCRActorPoolSubsystem.h"
+#include "Core/YCRRunCheckpoint.h"
+#include "Core/YCRSimulation.h"
+#include "Core/YCRInteractableRegistry.h"
+#include "Data/YCRLevelCurves.h"
 #include "Kismet/GameplayStatics.h"
-#include "DrawDebugHelpers.h"
 #include "Engine/OverlapResult.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayEffect.h"
+#include "Abilities/GameplayAbility.h"
 #include "GameplayEffectTypes.h"
 
 ACharacterPlayer::ACharacterPlayer()
@@ -54,8 +59,9 @@ ACharacterPlayer::ACharacterPlayer()
 
     // Player-specific defaults
     CurrentExperience = 0.0f;
-    ExperienceToNextLevel = 100.0f; // Base exp for level 2
+    ExperienceToNextLevel = FYCRLevelCurves::GetExperienceToNextLevel(1); // Base exp for level 2
     PickupRadius = 300.0f;
+    InteractionRadius = 200.0f;
     CurrentGold = 0;
     CurrentEssence = 0;
 }
@@ -74,6 +80,22 @@ void ACharacterPlayer::BeginPlay()
         
         YCRPlayerController = PlayerController;
     }
+    
+    // No viewport in a headless simulation
+    if (FYCRSimulation::IsEnabled())
+    {
+        CameraBoom->SetComponentTickEnabled(false);
+        FollowCamera->Deactivate();
+    }
+
+    // Keep the interaction prompt on the closest interactable (no prompts in a headless run)
+    if (IsLocallyControlled() && !FYCRSimulation::IsEnabled())
+    {
+        if (UYCRInteractableRegistry* Registry = GetWorld()->GetSubsystem<UYCRInteractableRegistry>())
+        {
+            Registry->SetFocusTracker(this, InteractionRadius);
+        }
+    }
 
     // Start periodic item collection
     GetWorldTimerManager().SetTimer(ItemCollectionTimerHandle, this, &ACharacterPlayer::CollectNearbyItems, 0.1f, true);
@@ -104,8 +126,11 @@ void ACharacterPlayer::SetupPlayerInputComponent(UInputComponent* PlayerInputCom
 void ACharacterPlayer::Move(const FInputActionValue& Value)
 {
     // Input is a Vector2D
-    FVector2D MovementVector = Value.Get<FVector2D>();
+    ApplyMoveInput(Value.Get<FVector2D>());
+}
 
+void ACharacterPlayer::ApplyMoveInput(FVector2D MovementVector)
+{
     if (Controller != nullptr)
     {
         // Find out which way is forward
@@ -147,80 +172,60 @@ void ACharacterPlayer::CollectExperience(float Amount)
     CurrentExperience += Amount;
 
     // Check for level up
-    while (CurrentExperience >= ExperienceToNextLevel)
+    if (CurrentExperience < ExperienceToNextLevel || CharacterLevel >= FYCRLevelCurves::MaxLevel)
     {
-        CurrentExperience -= ExperienceToNextLevel;
-        LevelUp();
+        return;
     }
+
+    // Closed form on the baked curve, however many thresholds this crosses
+    const double TotalExperience = FYCRLevelCurves::GetTotalExperienceForLevel(CharacterLevel) + CurrentExperience;
+    const int32 NewLevel = FYCRLevelCurves::GetLevelForTotalExperience(TotalExperience);
+    CurrentExperience = static_cast<float>(TotalExperience - FYCRLevelCurves::GetTotalExperienceForLevel(NewLevel));
+    LevelUp(NewLevel);
 }
 
-void ACharacterPlayer::LevelUp()
+void ACharacterPlayer::LevelUp(int32 NewLevel)
 {
+    const int32 LevelsGained = NewLevel - CharacterLevel;
+    if (LevelsGained <= 0)
+    {
+        return;
+    }
+
     // Increase character level
-    SetCharacterLevel(CharacterLevel + 1);
+    SetCharacterLevel(NewLevel);
 
-    // Calculate next level requirement (exponential growth)
-    ExperienceToNextLevel = FMath::RoundToFloat(ExperienceToNextLevel * 1.2f);
+    // Next level requirement from the experience curve
+    ExperienceToNextLevel = FYCRLevelCurves::GetExperienceToNextLevel(CharacterLevel);
 
-    // Trigger level up event for UI/selection
-    OnLevelUp();
+    // Trigger level up event for UI/selection (queues one pick per level)
+    OnLevelUp(CharacterLevel, LevelsGained);
 
     // Log for debugging
-    UE_LOG(LogTemp, Log, TEXT("Player leveled up to level %d!"), CharacterLevel);
+    UE_LOG(LogTemp, Log, TEXT("Player leveled up to level %d (+%d)!"), CharacterLevel, LevelsGained);
 }
 
 void ACharacterPlayer::CheckForInteractables()
 {
-    // Sphere trace for interactables
-    FVector StartLocation = GetActorLocation();
-    FVector EndLocation = StartLocation; // Same as start for sphere trace
-
-    TArray<FHitResult> HitResults;
-    FCollisionShape CollisionShape;
-    CollisionShape.SetSphere(200.0f); // Interaction radius
-
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(this);
-
-    bool bHit = GetWorld()->SweepMultiByChannel(
-        HitResults,
-        StartLocation,
-        EndLocation,
-        FQuat::Identity,
-        ECC_GameTraceChannel1, // Custom interaction channel
-        CollisionShape,
-        QueryParams
-    );
-
-    if (bHit)
+    // Registry lookup instead of a sweep on the interaction channel
+    const UYCRInteractableRegistry* Registry = GetWorld()->GetSubsystem<UYCRInteractableRegistry>();
+    AActor* Interactable = Registry ? Registry->FindClosestInteractable(GetActorLocation(), InteractionRadius, this) : nullptr;
+    if (!Interactable)
     {
-        for (const FHitResult& Hit : HitResults)
-        {
-            if (Hit.GetActor() && Hit.GetActor()->Implements<UIInteractableInterface>())
-            {
-                // Prüfe ob Interaktion möglich ist
-                if (IIInteractableInterface::Execute_CanInteract(Hit.GetActor(), this))
-                {
-                    // Führe Interaktion aus
-                    IIInteractableInterface::Execute_Interact(Hit.GetActor(), this);
-                    
-                    // Optional: Zeige Prompt
-                    FText Prompt = IIInteractableInterface::Execute_GetInteractionPrompt(Hit.GetActor());
-                    UE_LOG(LogTemp, Log, TEXT("Interacting: %s"), *Prompt.ToString());
-                }
-                break;
-            }
-        }
+        return;
     }
 
-    // Debug visualization
-#if ENABLE_DRAW_DEBUG
-    DrawDebugSphere(GetWorld(), StartLocation, 200.0f, 12, FColor::Yellow, false, 0.5f);
-#endif
+    // Führe Interaktion aus
+    IIInteractableInterface::Execute_Interact(Interactable, this);
+
+    UE_LOG(LogTemp, Verbose, TEXT("Interacting: %s"),
+        *IIInteractableInterface::Execute_GetInteractionPrompt(Interactable).ToString());
 }
 
 void ACharacterPlayer::CollectNearbyItems()
 {
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::Pickups);
+
     // Sphere overlap for automatic pickup
     TArray<FOverlapResult> OverlapResults;
     FCollisionShape CollisionShape;
@@ -238,6 +243,9 @@ void ACharacterPlayer::CollectNearbyItems()
         QueryParams
     );
 
+    // Experience of the whole sweep is added at once, so a vacuum levels up in one step
+    float CollectedExperience = 0.0f;
+
     if (bOverlap)
     {
         for (const FOverlapResult& Overlap : OverlapResults)
@@ -249,8 +257,8 @@ void ACharacterPlayer::CollectNearbyItems()
                 // For now, just destroy the actor and add experience
                 if (Overlap.GetActor()->ActorHasTag("Experience"))
                 {
-                    AddExperience(10.0f); // Base experience value
-                    Overlap.GetActor()->Destroy();
+                    CollectedExperience += 10.0f; // Base experience value
+                    UYCRActorPoolSubsystem::ReleaseOrDestroy(Overlap.GetActor());
                 }
                 else if (Overlap.GetActor()->ActorHasTag("Gold"))
                 {
@@ -260,6 +268,11 @@ void ACharacterPlayer::CollectNearbyItems()
             }
         }
     }
+
+    if (CollectedExperience > 0.0f)
+    {
+        AddExperience(CollectedExperience);
+    }
 }
 
 void ACharacterPlayer::AddExperience(float Amount)
@@ -284,6 +297,96 @@ float ACharacterPlayer::GetExperiencePercent() const
     return ExperienceToNextLevel > 0.0f ? CurrentExperience / ExperienceToNextLevel : 0.0f;
 }
 
+void ACharacterPlayer::WriteCheckpoint(FYCRRunCheckpoint& Checkpoint) const
+{
+    Checkpoint.PlayerYaw = GetActorRotation().Yaw;
+    Checkpoint.PlayerLevel = CharacterLevel;
+    Checkpoint.CurrentExperience = CurrentExperience;
+    Checkpoint.ExperienceToNextLevel = ExperienceToNextLevel;
+    Checkpoint.CurrentGold = CurrentGold;
+
+    if (!AbilitySystemComponent)
+    {
+        return;
+    }
+
+    // Base values only - active effects are rebuilt from the level on restore
+    TArray<FGameplayAttribute> Attributes;
+    UAttributeSet::GetAttributesFromSetClass(UYCRAttributeSet::StaticClass(), Attributes);
+    Checkpoint.AttributeBaseValues.Reset(Attributes.Num());
+    for (const FGameplayAttribute& Attribute : Attributes)
+    {
+        Checkpoint.AttributeBaseValues.Add(AbilitySystemComponent->GetNumericAttributeBase(Attribute));
+    }
+
+    Checkpoint.Abilities.Reset();
+    for (const FGameplayAbilitySpec& Spec : AbilitySystemComponent->GetActivatableAbilities())
+    {
+        if (Spec.Ability)
+        {
+            FYCRCheckpointAbility& Ability = Checkpoint.Abilities.AddDefaulted_GetRef();
+            Ability.ClassIndex = Checkpoint.AddClass(Spec.Ability->GetClass());
+            Ability.Level = static_cast<uint8>(FMath::Clamp(Spec.Level, 1, 255));
+        }
+    }
+}
+
+void ACharacterPlayer::RestoreFromCheckpoint(const FYCRRunCheckpoint& Checkpoint)
+{
+    SetActorLocationAndRotation(Checkpoint.Origin, FRotator(0.0f, Checkpoint.PlayerYaw, 0.0f),
+        false, nullptr, ETeleportType::TeleportPhysics);
+
+    SetCharacterLevel(Checkpoint.PlayerLevel);
+    CurrentExperience = Checkpoint.CurrentExperience;
+    ExperienceToNextLevel = Checkpoint.ExperienceToNextLevel;
+    CurrentGold = Checkpoint.CurrentGold;
+
+    if (!AbilitySystemComponent)
+    {
+        return;
+    }
+
+    // Written after the level effects so the checkpointed values win
+    TArray<FGameplayAttribute> Attributes;
+    UAttributeSet::GetAttributesFromSetClass(UYCRAttributeSet::StaticClass(), Attributes);
+    if (Attributes.Num() == Checkpoint.AttributeBaseValues.Num())
+    {
+        for (int32 Index = 0; Index < Attributes.Num(); Index++)
+        {
+            AbilitySystemComponent->SetNumericAttributeBase(Attributes[Index], Checkpoint.AttributeBaseValues[Index]);
+        }
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Run checkpoint has %d attributes, attribute set has %d - keeping level defaults"),
+            Checkpoint.AttributeBaseValues.Num(), Attributes.Num());
+    }
+
+    for (const FYCRCheckpointAbility& Ability : Checkpoint.Abilities)
+    {
+        if (!Checkpoint.ClassTable.IsValidIndex(Ability.ClassIndex))
+        {
+            continue;
+        }
+
+        UClass* AbilityClass = Checkpoint.ClassTable[Ability.ClassIndex].TryLoadClass<UGameplayAbility>();
+        if (!AbilityClass)
+        {
+            continue;
+        }
+
+        if (FGameplayAbilitySpec* Spec = AbilitySystemComponent->FindAbilitySpecFromClass(AbilityClass))
+        {
+            Spec->Level = Ability.Level;
+            AbilitySystemComponent->MarkAbilitySpecDirty(*Spec);
+        }
+        else
+        {
+            AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(AbilityClass, Ability.Level, INDEX_NONE, this));
+        }
+    }
+}
+
 void ACharacterPlayer::InitializeAbilitySystem()
 {
     Super::InitializeAbilitySystem();
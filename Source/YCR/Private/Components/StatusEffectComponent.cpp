@@ -1,5 +1,7 @@
 ﻿#include "YCR/Public/Components/StatusEffectComponent.h"
 #include "YCR/Public/Interfaces/IDamageableInterface.h"
+#include "YCR/Public/Core/YCRSimulation.h"
+#include "YCR/Public/Core/YCRHordeScalability.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/DamageEvents.h"
@@ -12,12 +14,17 @@ UStatusEffectComponent::UStatusEffectComponent()
 void UStatusEffectComponent::BeginPlay()
 {
     Super::BeginPlay();
+    
+    // Damage and duration use the accumulated delta and the slow is a fixed factor on the base speed,
+    // so a lower rate only coarsens the steps
+    SetComponentTickInterval(FYCRHordeScalability::GetStatusEffectTickInterval());
 }
 
 void UStatusEffectComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::Combat);
     ProcessStatusEffects(DeltaTime);
 }
 
@@ -38,15 +45,6 @@ void UStatusEffectComponent::ProcessStatusEffects(float DeltaTime)
             }
         }
         
-        // Apply slow
-        if (Effect.SlowPercent > 0.0f)
-        {
-            if (ACharacter* Character = Cast<ACharacter>(GetOwner()))
-            {
-                Character->GetCharacterMovement()->MaxWalkSpeed *= (1.0f - Effect.SlowPercent / 100.0f);
-            }
-        }
-        
         // Update duration
         Effect.Duration -= DeltaTime;
         if (Effect.Duration <= 0.0f)
@@ -54,6 +52,42 @@ void UStatusEffectComponent::ProcessStatusEffects(float DeltaTime)
             ActiveEffects.RemoveAt(i);
         }
     }
+    
+    UpdateSlow();
+}
+
+void UStatusEffectComponent::UpdateSlow()
+{
+    ACharacter* Character = Cast<ACharacter>(GetOwner());
+    UCharacterMovementComponent* Movement = Character ? Character->GetCharacterMovement() : nullptr;
+    if (!Movement)
+    {
+        return;
+    }
+    
+    float SlowFactor = 1.0f;
+    for (const FStatusEffect& Effect : ActiveEffects)
+    {
+        if (Effect.SlowPercent > 0.0f)
+        {
+            SlowFactor *= FMath::Clamp(1.0f - Effect.SlowPercent / 100.0f, 0.0f, 1.0f);
+        }
+    }
+    
+    // Slows scale the speed the character had before the first one, once, not per tick
+    if (SlowFactor < 1.0f)
+    {
+        if (BaseWalkSpeed < 0.0f)
+        {
+            BaseWalkSpeed = Movement->MaxWalkSpeed;
+        }
+        Movement->MaxWalkSpeed = BaseWalkSpeed * SlowFactor;
+    }
+    else if (BaseWalkSpeed >= 0.0f)
+    {
+        Movement->MaxWalkSpeed = BaseWalkSpeed;
+        BaseWalkSpeed = -1.0f;
+    }
 }
 
 void UStatusEffectComponent::ApplyStatusEffect(const FStatusEffect& NewEffect)
@@ -71,6 +105,7 @@ void UStatusEffectComponent::ApplyStatusEffect(const FStatusEffect& NewEffect)
     
     // Add new effect
     ActiveEffects.Add(NewEffect);
+    UpdateSlow();
 }
 
 void UStatusEffectComponent::RemoveStatusEffect(FName EffectName)
@@ -79,6 +114,7 @@ void UStatusEffectComponent::RemoveStatusEffect(FName EffectName)
     {
         return Effect.EffectName == EffectName;
     });
+    UpdateSlow();
 }
 
 bool UStatusEffectComponent::HasStatusEffect(FName EffectName) const
@@ -1,12 +1,15 @@
 ﻿#include "Components/YCREnemyAIComponent.h"
 #include "Character/CharacterBase.h"
 #include "Character/CharacterPlayer.h"
+#include "Core/YCRSimulation.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 
+float UYCREnemyAIComponent::LodDistanceSquared = FMath::Square(2500.0f);
+
 // Sets default values for this component's properties
 UYCREnemyAIComponent::UYCREnemyAIComponent()
 {
@@ -41,6 +44,8 @@ void UYCREnemyAIComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	
+	FYCRSimulationScope SimulationScope(EYCRSimulationCost::AI);
+	
 	// Ensure we have valid references
 	if (!OwnerCharacter || !OwnerCharacter->IsAlive())
 	{
@@ -54,6 +59,9 @@ void UYCREnemyAIComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 		return;
 	}
 	
+	// Far enemies think less often
+	UpdateLod();
+	
 	// Move towards player
 	MoveTowardsPlayer(DeltaTime);
 	
@@ -61,6 +69,16 @@ void UYCREnemyAIComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 	CheckAttackRange();
 }
 
+void UYCREnemyAIComponent::UpdateLod()
+{
+	const float DistSq = FVector::DistSquared2D(OwnerCharacter->GetActorLocation(), TargetPlayer->GetActorLocation());
+	const float DesiredInterval = DistSq > LodDistanceSquared ? LodTickInterval : 0.0f;
+	if (GetComponentTickInterval() != DesiredInterval)
+	{
+		SetComponentTickInterval(DesiredInterval);
+	}
+}
+
 void UYCREnemyAIComponent::MoveTowardsPlayer(float DeltaTime)
 {
 	if (!OwnerCharacter || !TargetPlayer || !TargetPlayer->IsAlive())
@@ -101,7 +119,7 @@ void UYCREnemyAIComponent::MoveTowardsPlayer(float DeltaTime)
 	
 	// Debug visualization
 #if WITH_EDITOR
-	if (GEngine && GEngine->GetDebugLocalPlayer())
+	if (GEngine && GEngine->GetDebugLocalPlayer() && !FYCRSimulation::IsEnabled())
 	{
 		DrawDebugLine(GetWorld(), OwnerLocation, TargetLocation, FColor::Red, false, -1.0f, 0, 2.0f);
 	}
@@ -0,0 +1,102 @@
+﻿#include "Components/YCREnemyBudgetController.h"
+#include "YCR/Public/Components/YCREnemyAIComponent.h"
+#include "YCR/Public/Core/YCRSpawnManager.h"
+#include "YCR/Public/Core/YCRHordeScalability.h"
+#include "YCR/Public/Core/YCRSimulation.h"
+#include "YCR/Public/Core/YCRBenchmarkPlayerController.h"
+#include "YCR/Public/Enemies/EnemyBase.h"
+#include "YCR/Public/GAS/YCRAttributeSet.h"
+#include "AbilitySystemComponent.h"
+
+UYCREnemyBudgetController::UYCREnemyBudgetController()
+{
+    // Measure after the frame's gameplay work is done; ticks only during a run
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+void UYCREnemyBudgetController::BeginRun(int32 InReferenceEnemyCount)
+{
+    ReferenceEnemyCount = FMath::Max(1, InReferenceEnemyCount);
+    Budget = InitialBudget;
+    SmoothedFrameMs = TargetFrameMs;
+
+    // Deterministic runs keep the neutral outputs and leave the AI LOD distance alone
+    bActive = bEnabled && !FYCRSimulation::IsEnabled() && !AYCRBenchmarkPlayerController::IsRequested();
+    if (bActive)
+    {
+        ApplyBudget();
+    }
+    else
+    {
+        EnemyCap = ReferenceEnemyCount;
+        SpawnRateMultiplier = 1.0f;
+        DifficultyCompensation = 1.0f;
+    }
+
+    SetComponentTickEnabled(bActive);
+}
+
+void UYCREnemyBudgetController::EndRun()
+{
+    bActive = false;
+    SetComponentTickEnabled(false);
+}
+
+void UYCREnemyBudgetController::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    // Game thread time of the previous frame, the part the horde actually costs
+    const float FrameMs = static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime));
+    const float Alpha = FMath::Clamp(DeltaTime / SmoothingTime, 0.0f, 1.0f);
+    SmoothedFrameMs = FMath::Lerp(SmoothedFrameMs, FrameMs, Alpha);
+
+    // Positive error = headroom, negative = over budget
+    const float Error = (TargetFrameMs - SmoothedFrameMs) / TargetFrameMs;
+    if (FMath::Abs(Error) <= DeadZone)
+    {
+        return;
+    }
+
+    const float OldBudget = Budget;
+    Budget = FMath::Clamp(Budget + Error * Gain * DeltaTime, 0.0f, 1.0f);
+    if (Budget != OldBudget)
+    {
+        ApplyBudget();
+    }
+}
+
+void UYCREnemyBudgetController::ApplyBudget()
+{
+    // Horde quality caps the bounds, the budget moves within what the machine tier allows
+    const int32 UpperCap = FMath::Min(FMath::Max(MinEnemyCap, MaxEnemyCap), FYCRHordeScalability::GetMaxLiveEnemies());
+    const int32 LowerCap = FMath::Min(MinEnemyCap, UpperCap);
+    EnemyCap = FMath::RoundToInt(FMath::Lerp(static_cast<float>(LowerCap), static_cast<float>(UpperCap), Budget));
+    SpawnRateMultiplier = FMath::Lerp(MinSpawnRateMultiplier, MaxSpawnRateMultiplier, Budget);
+    UYCREnemyAIComponent::SetLodDistance(
+        FMath::Lerp(MinAILodDistance, MaxAILodDistance, Budget) * FYCRHordeScalability::GetAILodDistanceScale());
+
+    // Keep the horde's total health and damage output near what the reference count would have
+    const float EnemyRatio = static_cast<float>(ReferenceEnemyCount) / EnemyCap;
+    DifficultyCompensation = FMath::Clamp(EnemyRatio, MinDifficultyCompensation, MaxDifficultyCompensation);
+}
+
+void UYCREnemyBudgetController::ApplyWaveScaling(AEnemyBase* Enemy, const FSpawnWaveData& Wave) const
+{
+    UAbilitySystemComponent* ASC = Enemy ? Enemy->GetAbilitySystemComponent() : nullptr;
+    if (!ASC)
+    {
+        return;
+    }
+
+    const float HealthScale = Wave.HealthMultiplier * DifficultyCompensation;
+    const float DamageScale = Wave.DamageMultiplier * DifficultyCompensation;
+
+    const float MaxHealth = ASC->GetNumericAttributeBase(UYCRAttributeSet::GetMaxHealthAttribute()) * HealthScale;
+    ASC->SetNumericAttributeBase(UYCRAttributeSet::GetMaxHealthAttribute(), MaxHealth);
+    ASC->SetNumericAttributeBase(UYCRAttributeSet::GetHealthAttribute(), MaxHealth);
+    ASC->SetNumericAttributeBase(UYCRAttributeSet::GetAttackPowerAttribute(),
+        ASC->GetNumericAttributeBase(UYCRAttributeSet::GetAttackPowerAttribute()) * DamageScale);
+}
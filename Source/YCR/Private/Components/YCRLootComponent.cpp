@@ -1,4 +1,13 @@
 ﻿#include "Components/YCRLootComponent.h"
+#include "Data/YCRLootTable.h"
+#include "Components/YCRRewardAggregator.h"
+#include "YCR/Public/Core/InGameMode.h"
+#include "YCR/Public/Core/GameInstanceYCR.h"
+#include "YCR/Public/Core/YCRSimulation.h"
+#include "YCR/Public/Core/YCRGameplayEventBus.h"
+#include "YCR/Public/Core/YCRDeveloperSettings.h"
+#include "YCR/Public/Data/YCRMapData.h"
+#include "Engine/AssetManager.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -6,147 +15,203 @@
 UYCRLootComponent::UYCRLootComponent()
 {
     PrimaryComponentTick.bCanEverTick = false;
+    LootTable = nullptr;
+    RewardAggregator = nullptr;
+    EventBus = nullptr;
+    MapLootTable = nullptr;
 }
 
 void UYCRLootComponent::BeginPlay()
 {
     Super::BeginPlay();
+
+    if (AInGameMode* GameMode = GetWorld()->GetAuthGameMode<AInGameMode>())
+    {
+        RewardAggregator = GameMode->GetRewardAggregator();
+    }
+
+    EventBus = UYCRGameplayEventBus::Get(this);
+
+    if (!LootTable)
+    {
+        MapLootTable = FindMapLootTable();
+    }
 }
 
-// Get coin amount based on monster type
-int32 UYCRLootComponent::GetCoinDropAmount(EYCRMonsterType MonsterType) const
+const UYCRLootTable* UYCRLootComponent::GetLootTable() const
 {
-    switch (MonsterType)
+    if (LootTable)
     {
-        case EYCRMonsterType::Normal:
-            return 1;   // 1 coin
-        case EYCRMonsterType::Elite:
-            return 3;   // 3 coins
-        case EYCRMonsterType::MiniBoss:
-            return 10;  // 10 coins
-        case EYCRMonsterType::Boss:
-            return 100; // 100 coins
-        case EYCRMonsterType::Special:
-            return 100; // 100 coins
-        default:
-            return 1;   // Default to 1 coin
+        return LootTable;
     }
+    
+    // Default object carries the shipped balance values, compiled in its constructor
+    return MapLootTable ? MapLootTable : GetDefault<UYCRLootTable>();
 }
 
-// Calculate total coins with variance
-int32 UYCRLootComponent::GetCalculatedCoinDrop(EYCRMonsterType MonsterType) const
+UYCRLootTable* UYCRLootComponent::FindMapLootTable() const
 {
-    // Get base coin amount for monster type
-    int32 BaseCoinAmount = GetCoinDropAmount(MonsterType);
+    const UGameInstanceYCR* GameInstance = GetWorld()->GetGameInstance<UGameInstanceYCR>();
+    if (!GameInstance || !UAssetManager::IsInitialized())
+    {
+        return nullptr;
+    }
     
-    // Add some variance for non-normal monsters (±10%)
-    if (MonsterType != EYCRMonsterType::Normal)
+    const FName Region = UYCRDeveloperSettings::Get()->GetMapRegion(GameInstance->GetCurrentRunData().CurrentLevel);
+    if (Region.IsNone())
     {
-        float Variance = FMath::RandRange(0.9f, 1.1f);
-        BaseCoinAmount = FMath::RoundToInt(BaseCoinAmount * Variance);
+        return nullptr;
     }
     
-    return FMath::Max(1, BaseCoinAmount); // Ensure at least 1 coin drops
+    // Loaded together with the map's InRun bundle before the run, never loads here
+    const UYCRMapData* MapData = UAssetManager::Get().GetPrimaryAssetObject<UYCRMapData>(UYCRMapData::MakePrimaryAssetId(Region));
+    return MapData ? MapData->LootTable.Get() : nullptr;
 }
 
 // Drop coins at monster death
-void UYCRLootComponent::DropCoins(const FVector& DropLocation, EYCRMonsterType MonsterType)
+void UYCRLootComponent::DropCoins(const FVector& DropLocation, int32 CoinAmount)
 {
-    int32 CoinAmount = GetCalculatedCoinDrop(MonsterType);
-    
     // Log the drop for debugging
-    UE_LOG(LogTemp, Log, TEXT("Dropping %d coins for monster type: %s"), 
+    UE_LOG(LogTemp, Verbose, TEXT("Dropping %d coins for monster type: %s"), 
         CoinAmount, 
         *UEnum::GetValueAsString(MonsterType));
     
+    if (RewardAggregator)
+    {
+        RewardAggregator->RecordGold(CoinAmount, DropLocation);
+    }
+    
     // Trigger the coin drop event
-    OnCoinDropped.Broadcast(CoinAmount, DropLocation);
+    if (EventBus)
+    {
+        FYCRCoinDroppedEvent Event;
+        Event.Location = DropLocation;
+        Event.CoinValue = CoinAmount;
+        EventBus->Post(Event);
+    }
     
     // TODO: Spawn actual coin pickup actors here
     // This would spawn coin pickup actors in the world
 }
 
 // Get experience multiplier for monster type
-float UYCRLootComponent::GetExpMultiplierForType(EYCRMonsterType MonsterType) const
+float UYCRLootComponent::GetExpMultiplierForType(EYCRMonsterType InMonsterType) const
 {
-    switch (MonsterType)
-    {
-        case EYCRMonsterType::Normal:
-            return 1.0f;
-        case EYCRMonsterType::Elite:
-            return 3.0f;
-        case EYCRMonsterType::MiniBoss:
-            return 10.0f;
-        case EYCRMonsterType::Boss:
-            return 50.0f;
-        case EYCRMonsterType::Special:
-            return 100.0f;
-        default:
-            return 1.0f;
-    }
+    return GetLootTable()->GetExpMultiplier(InMonsterType);
 }
 
 // Get gem drop chance for monster type
-float UYCRLootComponent::GetGemDropChanceForType(EYCRMonsterType MonsterType) const
+float UYCRLootComponent::GetGemDropChanceForType(EYCRMonsterType InMonsterType) const
+{
+    return GetLootTable()->GetDropChance(InMonsterType, EYCRLootDropKind::OutGameGem);
+}
+
+// Get gem color based on monster type
+EYCRGemColor UYCRLootComponent::GetGemColorForType(EYCRMonsterType InMonsterType) const
 {
-    switch (MonsterType)
+    return GetLootTable()->GetGemColor(InMonsterType);
+}
+
+// Main loot generation function
+void UYCRLootComponent::GenerateLoot(const FVector& DropLocation, EYCRMonsterType InMonsterType, int32 MonsterLevel)
+{
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::Loot);
+
+    const UYCRLootTable* Table = GetLootTable();
+
+    FYCRLootRollRequest Request;
+    Request.MonsterType = InMonsterType;
+    Request.MonsterLevel = MonsterLevel;
+
+    if (RewardAggregator)
     {
-        case EYCRMonsterType::Normal:
-            return 1.0f;    // 1% chance
-        case EYCRMonsterType::Elite:
-            return 5.0f;    // 5% chance
-        case EYCRMonsterType::MiniBoss:
-            return 25.0f;   // 25% chance
-        case EYCRMonsterType::Boss:
-            return 100.0f;  // 100% chance (always drops)
-        case EYCRMonsterType::Special:
-            return 100.0f;  // 100% chance (always drops)
-        default:
-            return 1.0f;
+        // Rolled together with every other kill of the frame
+        RewardAggregator->QueueLootRoll(this, Request, DropLocation);
+    }
+    else
+    {
+        // Roll every loot group once - O(1) per group regardless of entry count
+        DropBuffer.Reset();
+        Table->RollLoot(Request, UGameInstanceYCR::GetRandomStream(this, EYCRRandomStream::Loot), DropBuffer);
+        for (const FYCRLootDrop& Drop : DropBuffer)
+        {
+            HandleLootDrop(Drop, DropLocation);
+        }
+    }
+
+    RollBuffScroll(DropLocation);
+
+    // Per-drop events only when nobody aggregates them for this frame
+    const bool bBroadcast = !RewardAggregator || bBroadcastIndividualDrops;
+
+    // Broadcast experience gained
+    const int32 Experience = Table->GetExperienceFor(InMonsterType, MonsterLevel);
+    if (RewardAggregator)
+    {
+        RewardAggregator->RecordExperience(Experience);
+    }
+    if (bBroadcast)
+    {
+        OnExperienceDropped.Broadcast(Experience);
+    }
+    if (EventBus)
+    {
+        FYCRExpGemDroppedEvent Event;
+        Event.Location = DropLocation;
+        Event.ExpValue = Experience;
+        EventBus->Post(Event);
     }
 }
 
-// Get gem color based on monster type
-EYCRGemColor UYCRLootComponent::GetGemColorForType(EYCRMonsterType MonsterType) const
+void UYCRLootComponent::RollBuffScroll(const FVector& DropLocation)
 {
-    switch (MonsterType)
+    if (AvailableBuffScrolls.IsEmpty() || BuffScrollDropChance <= 0.0f)
     {
-        case EYCRMonsterType::Normal:
-            return EYCRGemColor::White;
-        case EYCRMonsterType::Elite:
-            return EYCRGemColor::Green;
-        case EYCRMonsterType::MiniBoss:
-            return EYCRGemColor::Blue;
-        case EYCRMonsterType::Boss:
-            return EYCRGemColor::Purple;
-        case EYCRMonsterType::Special:
-            return EYCRGemColor::Red;   // Assuming Red for special
-        default:
-            return EYCRGemColor::White;
+        return;
     }
+
+    // One group: a scroll with BuffScrollDropChance, evenly split between the available types
+    FRandomStream& Stream = UGameInstanceYCR::GetRandomStream(this, EYCRRandomStream::Loot);
+    if (Stream.FRandRange(0.0f, 100.0f) >= BuffScrollDropChance)
+    {
+        return;
+    }
+
+    FYCRLootDrop Drop;
+    Drop.DropKind = EYCRLootDropKind::BuffScroll;
+    Drop.Amount = 1;
+    Drop.BuffType = AvailableBuffScrolls[Stream.RandHelper(AvailableBuffScrolls.Num())];
+    HandleLootDrop(Drop, DropLocation);
 }
 
-// Main loot generation function
-void UYCRLootComponent::GenerateLoot(const FVector& DropLocation, EYCRMonsterType MonsterType, int32 MonsterLevel)
+void UYCRLootComponent::HandleLootDrop(const FYCRLootDrop& Drop, const FVector& DropLocation)
 {
-    // Drop coins
-    DropCoins(DropLocation, MonsterType);
-    
-    // Calculate experience
-    int32 BaseExp = 10; // Base experience value
-    float ExpMultiplier = GetExpMultiplierForType(MonsterType);
-    int32 TotalExp = FMath::RoundToInt(BaseExp * ExpMultiplier * MonsterLevel);
-    
-    // Broadcast experience gained
-    OnExperienceDropped.Broadcast(TotalExp);
-    
-    // Check for gem drops
-    float GemChance = GetGemDropChanceForType(MonsterType);
-    if (FMath::RandRange(0.0f, 100.0f) <= GemChance)
+    switch (Drop.DropKind)
     {
-        EYCRGemColor GemColor = GetGemColorForType(MonsterType);
-        OnGemDropped.Broadcast(GemColor, DropLocation);
+        case EYCRLootDropKind::Coins:
+            DropCoins(DropLocation, FMath::Max(1, Drop.Amount));
+            break;
+        case EYCRLootDropKind::OutGameGem:
+            if (RewardAggregator)
+            {
+                RewardAggregator->RecordGem(Drop.GemColor, DropLocation);
+            }
+            if (!RewardAggregator || bBroadcastIndividualDrops)
+            {
+                OnGemDropped.Broadcast(Drop.GemColor, DropLocation);
+            }
+            break;
+        case EYCRLootDropKind::BuffScroll:
+        {
+            FYCRBuffScrollData BuffData;
+            BuffData.BuffType = Drop.BuffType;
+            OnBuffScrollDropped.Broadcast(BuffData);
+            break;
+        }
+        case EYCRLootDropKind::RareItem:
+            OnRareItemDropped.Broadcast(Drop.ItemID, DropLocation);
+            break;
+        default:
+            break;
     }
-    
-    // TODO: Add additional loot types (items, equipment, etc.)
-}
\ No newline at end of file
+}
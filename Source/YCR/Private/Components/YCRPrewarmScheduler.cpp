@@ -0,0 +1,255 @@
+﻿#include "Components/YCRPrewarmScheduler.h"
+#include "YCR/Public/Core/InGameMode.h"
+#include "YCR/Public/Core/GameInstanceYCR.h"
+#include "YCR/Public/Core/YCRActorPoolSubsystem.h"
+#include "YCR/Public/Core/YCRDeveloperSettings.h"
+#include "YCR/Public/Core/YCRSpawnManager.h"
+#include "YCR/Public/Data/YCRMapData.h"
+#include "YCR/Public/Data/YCRPrimaryAssetTypes.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+
+UYCRPrewarmScheduler::UYCRPrewarmScheduler()
+{
+    // Only ticks while pool instances are being spawned
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void UYCRPrewarmScheduler::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    EndRun();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+// =====================================================
+// Timeline
+// =====================================================
+
+void UYCRPrewarmScheduler::BeginRun(float RunTime)
+{
+    EndRun();
+    BuildTimeline();
+    Update(RunTime);
+}
+
+void UYCRPrewarmScheduler::BuildTimeline()
+{
+    Events.Reset();
+
+    // Waves: each one is needed until the next one starts
+    for (TActorIterator<AYCRSpawnManager> It(GetWorld()); It; ++It)
+    {
+        const UDataTable* WaveTable = It->GetSpawnWaveTable();
+        if (!WaveTable)
+        {
+            continue;
+        }
+
+        WaveTable->ForeachRow<FSpawnWaveData>(TEXT("UYCRPrewarmScheduler"), [this](const FName& RowName, const FSpawnWaveData& Wave)
+        {
+            FPrewarmEvent& Event = Events.AddDefaulted_GetRef();
+            Event.StartTime = Wave.StartTime;
+            for (const TSoftClassPtr<ACharacterBase>& MonsterClass : Wave.MonsterClasses)
+            {
+                if (!MonsterClass.IsNull())
+                {
+                    Event.Classes.AddUnique(MonsterClass.ToSoftObjectPath());
+                }
+            }
+        });
+    }
+
+    Events.StableSort([](const FPrewarmEvent& A, const FPrewarmEvent& B) { return A.StartTime < B.StartTime; });
+    for (int32 i = 0; i + 1 < Events.Num(); i++)
+    {
+        Events[i].EndTime = Events[i + 1].StartTime;
+    }
+
+    // Boss: needed from its spawn time until the run ends
+    if (const AInGameMode* GameMode = GetOwner<AInGameMode>())
+    {
+        if (!GameMode->GetBossClass().IsNull())
+        {
+            FPrewarmEvent& Event = Events.AddDefaulted_GetRef();
+            Event.StartTime = GameMode->GetBossSpawnTime();
+            Event.PoolSize = PoolSizeBoss;
+            Event.bBoss = true;
+            Event.Classes.Add(GameMode->GetBossClass().ToSoftObjectPath());
+        }
+    }
+
+    Events.RemoveAll([](const FPrewarmEvent& Event) { return Event.Classes.IsEmpty(); });
+    Events.StableSort([](const FPrewarmEvent& A, const FPrewarmEvent& B) { return A.StartTime < B.StartTime; });
+
+    UE_LOG(LogTemp, Log, TEXT("Prewarm timeline: %d events, lead time %.0f s"), Events.Num(), LeadTime);
+}
+
+void UYCRPrewarmScheduler::Update(float RunTime)
+{
+    for (int32 i = 0; i < Events.Num(); i++)
+    {
+        FPrewarmEvent& Event = Events[i];
+
+        if (!Event.bRequested && RunTime >= Event.StartTime - LeadTime && RunTime < Event.EndTime)
+        {
+            RequestEvent(i);
+        }
+        else if (Event.bRequested && !Event.bReleased && RunTime >= Event.EndTime + UnloadGraceTime)
+        {
+            ReleaseEvent(i);
+        }
+    }
+}
+
+void UYCRPrewarmScheduler::EndRun()
+{
+    for (int32 i = 0; i < Events.Num(); i++)
+    {
+        if (Events[i].Handle.IsValid())
+        {
+            Events[i].Handle->CancelHandle();
+            Events[i].Handle.Reset();
+        }
+    }
+    Events.Reset();
+    PoolRequests.Reset();
+    SetComponentTickEnabled(false);
+
+    // Give the Boss bundle back, InRun stays as the menu requested it
+    if (BossBundleIds.Num() > 0 && UAssetManager::IsInitialized())
+    {
+        UAssetManager::Get().ChangeBundleStateForPrimaryAssets(BossBundleIds, {}, { FYCRAssetBundles::Boss });
+        BossBundleIds.Reset();
+    }
+}
+
+// =====================================================
+// Loading
+// =====================================================
+
+void UYCRPrewarmScheduler::RequestEvent(int32 EventIndex)
+{
+    FPrewarmEvent& Event = Events[EventIndex];
+    Event.bRequested = true;
+
+    // The boss event also pulls in the rest of the map's Boss bundle (arena props, music...)
+    if (Event.bBoss)
+    {
+        LoadBossBundle();
+    }
+
+    Event.Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Event.Classes,
+        FStreamableDelegate::CreateUObject(this, &UYCRPrewarmScheduler::OnEventLoaded, EventIndex),
+        FStreamableManager::AsyncLoadHighPriority - 1);
+
+    UE_LOG(LogTemp, Verbose, TEXT("Prewarming %d classes for run time %.0f"), Event.Classes.Num(), Event.StartTime);
+}
+
+void UYCRPrewarmScheduler::OnEventLoaded(int32 EventIndex)
+{
+    // Only events with a pool size (the boss) spawn instances
+    if (!bPrewarmPool || !Events.IsValidIndex(EventIndex) || Events[EventIndex].bReleased || Events[EventIndex].PoolSize <= 0)
+    {
+        return;
+    }
+
+    // Pool instances are spawned a few per frame from TickComponent
+    const FPrewarmEvent& Event = Events[EventIndex];
+    for (const FSoftObjectPath& ClassPath : Event.Classes)
+    {
+        if (UClass* Class = Cast<UClass>(ClassPath.ResolveObject()))
+        {
+            FPoolRequest& Request = PoolRequests.AddDefaulted_GetRef();
+            Request.Class = Class;
+            Request.TargetFree = Event.PoolSize;
+        }
+    }
+
+    SetComponentTickEnabled(PoolRequests.Num() > 0);
+}
+
+void UYCRPrewarmScheduler::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    UYCRActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UYCRActorPoolSubsystem>();
+    if (!Pool || PoolRequests.IsEmpty())
+    {
+        PoolRequests.Reset();
+        SetComponentTickEnabled(false);
+        return;
+    }
+
+    FPoolRequest& Request = PoolRequests[0];
+    UClass* Class = Request.Class.Get();
+    const int32 Free = Class ? Pool->GetFreeCount(Class) : Request.TargetFree;
+
+    if (Free < Request.TargetFree)
+    {
+        Pool->PrewarmPool(Class, FMath::Min(Free + PoolSpawnsPerFrame, Request.TargetFree));
+    }
+    else
+    {
+        PoolRequests.RemoveAt(0, 1, EAllowShrinking::No);
+    }
+}
+
+void UYCRPrewarmScheduler::ReleaseEvent(int32 EventIndex)
+{
+    FPrewarmEvent& Event = Events[EventIndex];
+    Event.bReleased = true;
+
+    // Other events holding the same class keep it loaded through their own handle
+    if (Event.Handle.IsValid())
+    {
+        Event.Handle->ReleaseHandle();
+        Event.Handle.Reset();
+    }
+
+    UYCRActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UYCRActorPoolSubsystem>();
+    for (const FSoftObjectPath& ClassPath : Event.Classes)
+    {
+        if (IsClassStillNeeded(ClassPath, EventIndex))
+        {
+            continue;
+        }
+
+        // Pooled instances would keep the class alive
+        if (UClass* Class = Cast<UClass>(ClassPath.ResolveObject()); Class && Pool)
+        {
+            Pool->TrimPool(Class);
+        }
+    }
+}
+
+bool UYCRPrewarmScheduler::IsClassStillNeeded(const FSoftObjectPath& ClassPath, int32 IgnoredEventIndex) const
+{
+    for (int32 i = 0; i < Events.Num(); i++)
+    {
+        if (i != IgnoredEventIndex && !Events[i].bReleased && Events[i].Classes.Contains(ClassPath))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void UYCRPrewarmScheduler::LoadBossBundle()
+{
+    const UGameInstanceYCR* GameInstance = GetWorld()->GetGameInstance<UGameInstanceYCR>();
+    const FName Region = GameInstance
+        ? UYCRDeveloperSettings::Get()->GetMapRegion(GameInstance->GetCurrentRunData().CurrentLevel)
+        : NAME_None;
+    if (Region.IsNone() || !UAssetManager::IsInitialized())
+    {
+        return;
+    }
+
+    const FPrimaryAssetId MapId = UYCRMapData::MakePrimaryAssetId(Region);
+    BossBundleIds.AddUnique(MapId);
+    UAssetManager::Get().ChangeBundleStateForPrimaryAssets(BossBundleIds, { FYCRAssetBundles::Boss }, {});
+}
@@ -0,0 +1,145 @@
+﻿#include "Components/YCRRewardAggregator.h"
+#include "Components/YCRLootComponent.h"
+#include "YCR/Public/Core/GameInstanceYCR.h"
+#include "YCR/Public/Core/YCRSimulation.h"
+#include "Engine/World.h"
+
+UYCRRewardAggregator::UYCRRewardAggregator()
+{
+    // Flush after gameplay and physics so every kill of the frame is included
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+void UYCRRewardAggregator::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    Flush();
+}
+
+void UYCRRewardAggregator::RecordKill(EYCRMonsterType MonsterType)
+{
+    const int32 TypeIndex = static_cast<int32>(MonsterType);
+    if (Pending.KillsPerMonsterType.IsValidIndex(TypeIndex))
+    {
+        Pending.KillsPerMonsterType[TypeIndex]++;
+    }
+    Pending.TotalKills++;
+}
+
+void UYCRRewardAggregator::RecordExperience(int32 Amount)
+{
+    Pending.TotalExperience += Amount;
+}
+
+void UYCRRewardAggregator::RecordGold(int32 Amount, const FVector& DropLocation)
+{
+    Pending.TotalGold += Amount;
+    AddDropLocation(DropLocation);
+}
+
+void UYCRRewardAggregator::RecordGem(EYCRGemColor GemColor, const FVector& DropLocation)
+{
+    Pending.GemColors.Add(GemColor);
+    AddDropLocation(DropLocation);
+}
+
+void UYCRRewardAggregator::QueueLootRoll(UYCRLootComponent* Source, const FYCRLootRollRequest& Request, const FVector& DropLocation)
+{
+    if (!Source)
+    {
+        return;
+    }
+
+    FPendingLootRoll& Roll = PendingLootRolls.AddDefaulted_GetRef();
+    Roll.Source = Source;
+    Roll.Table = Source->GetLootTable();
+    Roll.Request = Request;
+    Roll.DropLocation = DropLocation;
+}
+
+void UYCRRewardAggregator::RollPendingLoot()
+{
+    if (PendingLootRolls.IsEmpty())
+    {
+        return;
+    }
+
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::Loot);
+
+    const FRandomStream& Stream = UGameInstanceYCR::GetRandomStream(this, EYCRRandomStream::Loot);
+
+    // One batch per table in first-seen order; kills keep their queue order so the run seed replays
+    TArray<const UYCRLootTable*, TInlineAllocator<4>> Tables;
+    for (const FPendingLootRoll& Roll : PendingLootRolls)
+    {
+        Tables.AddUnique(Roll.Table);
+    }
+
+    for (const UYCRLootTable* Table : Tables)
+    {
+        BatchRequests.Reset();
+        BatchRollIndices.Reset();
+        for (int32 i = 0; i < PendingLootRolls.Num(); i++)
+        {
+            if (PendingLootRolls[i].Table == Table)
+            {
+                BatchRequests.Add(PendingLootRolls[i].Request);
+                BatchRollIndices.Add(i);
+            }
+        }
+
+        BatchDrops.Reset();
+        Table->RollLootBatch(BatchRequests, Stream, BatchDrops);
+
+        for (const FYCRLootDrop& Drop : BatchDrops)
+        {
+            const FPendingLootRoll& Roll = PendingLootRolls[BatchRollIndices[Drop.RequestIndex]];
+            if (UYCRLootComponent* Source = Roll.Source.Get())
+            {
+                Source->HandleLootDrop(Drop, Roll.DropLocation);
+            }
+        }
+    }
+
+    PendingLootRolls.Reset();
+}
+
+void UYCRRewardAggregator::AddDropLocation(const FVector& DropLocation)
+{
+    // Coins and gems of the same kill share a location
+    if (Pending.DropLocations.IsEmpty() || !Pending.DropLocations.Last().Equals(DropLocation))
+    {
+        Pending.DropLocations.Add(DropLocation);
+    }
+}
+
+void UYCRRewardAggregator::Flush()
+{
+    // Loot first, its coins and gems belong to this frame's summary
+    RollPendingLoot();
+
+    if (Pending.IsEmpty())
+    {
+        return;
+    }
+
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::Progression);
+
+    // Progression: one game instance update per frame instead of one per kill
+    if (UGameInstanceYCR* GameInstance = GetWorld() ? GetWorld()->GetGameInstance<UGameInstanceYCR>() : nullptr)
+    {
+        GameInstance->UpdateRunStats(
+            Pending.TotalKills,
+            Pending.GetKills(EYCRMonsterType::Elite),
+            Pending.GetKills(EYCRMonsterType::Boss),
+            Pending.TotalGold,
+            Pending.TotalExperience);
+    }
+
+    // UI
+    OnRewardsAggregated.Broadcast(Pending);
+
+    Pending.Reset();
+}
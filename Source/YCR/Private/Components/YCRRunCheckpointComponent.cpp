@@ -0,0 +1,269 @@
+﻿#include "Components/YCRRunCheckpointComponent.h"
+#include "YCR/Public/Core/GameInstanceYCR.h"
+#include "YCR/Public/Core/InGameMode.h"
+#include "YCR/Public/Core/YCRActorPoolSubsystem.h"
+#include "YCR/Public/Core/YCRSimulation.h"
+#include "YCR/Public/Core/YCRGems.h"
+#include "YCR/Public/Character/CharacterPlayer.h"
+#include "YCR/Public/Enemies/EnemyBase.h"
+#include "YCR/Public/GAS/YCRAttributeSet.h"
+#include "AbilitySystemComponent.h"
+#include "EngineUtils.h"
+#include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
+#include "Engine/World.h"
+
+namespace YCRRunCheckpointComponent
+{
+    // Pickups are found by the same tag the player collects them by
+    const FName ExperienceTag = TEXT("Experience");
+}
+
+UYCRRunCheckpointComponent::UYCRRunCheckpointComponent()
+{
+    // Only ticks while a restore is spread over frames
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void UYCRRunCheckpointComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    StopCheckpointing();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+// =====================================================
+// Capture
+// =====================================================
+
+void UYCRRunCheckpointComponent::StartCheckpointing()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().SetTimer(CheckpointTimerHandle, this, &UYCRRunCheckpointComponent::OnCheckpointTimer,
+            CheckpointInterval, true);
+    }
+}
+
+void UYCRRunCheckpointComponent::StopCheckpointing()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(CheckpointTimerHandle);
+    }
+}
+
+void UYCRRunCheckpointComponent::WriteCheckpoint(bool bWaitForWrite)
+{
+    const AInGameMode* GameMode = GetOwner<AInGameMode>();
+    UGameInstanceYCR* GameInstance = GetWorld() ? GetWorld()->GetGameInstance<UGameInstanceYCR>() : nullptr;
+
+    // A checkpoint taken mid-restore would lose whatever is still queued
+    if (!GameMode || !GameInstance || !GameMode->IsRunActive() || bRestoring)
+    {
+        return;
+    }
+
+    const double CaptureStart = FPlatformTime::Seconds();
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::Checkpoint);
+
+    FYCRRunCheckpoint Checkpoint;
+    CaptureCheckpoint(Checkpoint);
+    GameInstance->WriteRunCheckpoint(Checkpoint, bWaitForWrite);
+
+    UE_LOG(LogTemp, Verbose, TEXT("Run checkpoint captured (%d enemies, %d gems, %.3f ms)"),
+        Checkpoint.Enemies.Num(), Checkpoint.Gems.Num(), (FPlatformTime::Seconds() - CaptureStart) * 1000.0);
+}
+
+void UYCRRunCheckpointComponent::CaptureCheckpoint(FYCRRunCheckpoint& OutCheckpoint) const
+{
+    const AInGameMode* GameMode = GetOwner<AInGameMode>();
+    if (const UGameInstanceYCR* GameInstance = GetWorld()->GetGameInstance<UGameInstanceYCR>())
+    {
+        GameInstance->FillRunCheckpoint(OutCheckpoint);
+    }
+
+    OutCheckpoint.RunTime = GameMode->GetCurrentRunTime();
+    OutCheckpoint.bBossSpawned = GameMode->IsBossSpawned();
+
+    // Positions are stored relative to the player
+    if (const ACharacterPlayer* Player = Cast<ACharacterPlayer>(UGameplayStatics::GetPlayerCharacter(this, 0)))
+    {
+        OutCheckpoint.Origin = Player->GetActorLocation();
+        Player->WriteCheckpoint(OutCheckpoint);
+    }
+
+    // Pooled actors are hidden while inactive
+    for (TActorIterator<AEnemyBase> It(GetWorld()); It; ++It)
+    {
+        const AEnemyBase* Enemy = *It;
+        if (Enemy->IsDead() || Enemy->IsHidden())
+        {
+            continue;
+        }
+
+        FYCRCheckpointEnemy& Entry = OutCheckpoint.Enemies.AddDefaulted_GetRef();
+        Entry.ClassIndex = OutCheckpoint.AddClass(Enemy->GetClass());
+        OutCheckpoint.QuantizePosition(Enemy->GetActorLocation(), Entry.Position);
+        Entry.Yaw = static_cast<uint8>(FMath::RoundToInt(FRotator::ClampAxis(Enemy->GetActorRotation().Yaw) / 360.0f * 256.0f) & 0xFF);
+        Entry.Level = static_cast<uint8>(FMath::Clamp(Enemy->GetCharacterLevel(), 1, 255));
+        Entry.HealthFraction = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Enemy->GetHealthPercent() * 255.0f), 1, 255));
+    }
+
+    TArray<AActor*> Pickups;
+    UGameplayStatics::GetAllActorsWithTag(this, YCRRunCheckpointComponent::ExperienceTag, Pickups);
+    OutCheckpoint.Gems.Reserve(Pickups.Num());
+    for (const AActor* Pickup : Pickups)
+    {
+        if (Pickup->IsHidden())
+        {
+            continue;
+        }
+
+        FYCRCheckpointGem& Entry = OutCheckpoint.Gems.AddDefaulted_GetRef();
+        Entry.ClassIndex = OutCheckpoint.AddClass(Pickup->GetClass());
+        OutCheckpoint.QuantizePosition(Pickup->GetActorLocation(), Entry.Position);
+        if (const AYCRGemPickup* Gem = Cast<AYCRGemPickup>(Pickup))
+        {
+            Entry.GemColor = static_cast<uint8>(Gem->GetGemColor());
+            Entry.ExperienceValue = Gem->GetExperienceValue();
+        }
+    }
+}
+
+// =====================================================
+// Restore
+// =====================================================
+
+void UYCRRunCheckpointComponent::BeginRestore(FYCRRunCheckpoint&& Checkpoint)
+{
+    RestoreData = MoveTemp(Checkpoint);
+    ResolvedClasses.Reset();
+    ResolvedClasses.SetNum(RestoreData.ClassTable.Num());
+    NextEnemyIndex = 0;
+    NextGemIndex = 0;
+    bRestoring = true;
+
+    // The player has to be complete on the first frame, everything else can trickle in
+    if (ACharacterPlayer* Player = Cast<ACharacterPlayer>(UGameplayStatics::GetPlayerCharacter(this, 0)))
+    {
+        Player->RestoreFromCheckpoint(RestoreData);
+    }
+
+    SetComponentTickEnabled(true);
+}
+
+void UYCRRunCheckpointComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (!bRestoring)
+    {
+        SetComponentTickEnabled(false);
+        return;
+    }
+
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::Checkpoint);
+
+    // Always make progress, even if a single class load blows the budget
+    const double Deadline = FPlatformTime::Seconds() + RestoreFrameBudgetMs / 1000.0;
+    do
+    {
+        if (NextEnemyIndex < RestoreData.Enemies.Num())
+        {
+            RestoreEnemy(RestoreData.Enemies[NextEnemyIndex++]);
+        }
+        else if (NextGemIndex < RestoreData.Gems.Num())
+        {
+            RestoreGem(RestoreData.Gems[NextGemIndex++]);
+        }
+        else
+        {
+            FinishRestore();
+            return;
+        }
+    }
+    while (FPlatformTime::Seconds() < Deadline);
+}
+
+UClass* UYCRRunCheckpointComponent::ResolveClass(uint16 ClassIndex)
+{
+    if (!ResolvedClasses.IsValidIndex(ClassIndex))
+    {
+        return nullptr;
+    }
+
+    TOptional<UClass*>& Resolved = ResolvedClasses[ClassIndex];
+    if (!Resolved.IsSet())
+    {
+        // Usually already loaded by the map's spawn tables
+        Resolved = RestoreData.ClassTable[ClassIndex].TryLoadClass<AActor>();
+    }
+    return Resolved.GetValue();
+}
+
+void UYCRRunCheckpointComponent::RestoreEnemy(const FYCRCheckpointEnemy& Enemy)
+{
+    UClass* EnemyClass = ResolveClass(Enemy.ClassIndex);
+    if (!EnemyClass)
+    {
+        return;
+    }
+
+    const FTransform Transform(FRotator(0.0f, Enemy.Yaw * 360.0f / 256.0f, 0.0f),
+        RestoreData.DequantizePosition(Enemy.Position));
+
+    AActor* Actor = nullptr;
+    if (UYCRActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UYCRActorPoolSubsystem>())
+    {
+        Actor = Pool->AcquireActor(EnemyClass, Transform);
+    }
+    else
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+        Actor = GetWorld()->SpawnActor<AActor>(EnemyClass, Transform, SpawnParams);
+    }
+
+    AEnemyBase* Restored = Cast<AEnemyBase>(Actor);
+    if (!Restored)
+    {
+        return;
+    }
+
+    Restored->SetCharacterLevel(Enemy.Level);
+
+    if (AInGameMode* GameMode = GetWorld()->GetAuthGameMode<AInGameMode>())
+    {
+        GameMode->OnEnemySpawned(Restored);
+    }
+
+    if (UAbilitySystemComponent* AbilitySystem = Restored->GetAbilitySystemComponent())
+    {
+        const float MaxHealth = AbilitySystem->GetNumericAttribute(UYCRAttributeSet::GetMaxHealthAttribute());
+        AbilitySystem->SetNumericAttributeBase(UYCRAttributeSet::GetHealthAttribute(), MaxHealth * Enemy.HealthFraction / 255.0f);
+    }
+}
+
+void UYCRRunCheckpointComponent::RestoreGem(const FYCRCheckpointGem& Gem)
+{
+    // Through the spawner so a reused pickup gets the stored colour and value, not the ones it was released with
+    UClass* GemClass = ResolveClass(Gem.ClassIndex);
+    if (GemClass && GemClass->IsChildOf<AYCRGemPickup>())
+    {
+        UYCRGemSpawner::SpawnGem(this, GemClass, RestoreData.DequantizePosition(Gem.Position),
+            static_cast<EYCRGemColor>(Gem.GemColor), Gem.ExperienceValue);
+    }
+}
+
+void UYCRRunCheckpointComponent::FinishRestore()
+{
+    UE_LOG(LogTemp, Log, TEXT("Run checkpoint restored (%d enemies, %d gems)"),
+        RestoreData.Enemies.Num(), RestoreData.Gems.Num());
+
+    bRestoring = false;
+    RestoreData = FYCRRunCheckpoint();
+    ResolvedClasses.Reset();
+    SetComponentTickEnabled(false);
+}
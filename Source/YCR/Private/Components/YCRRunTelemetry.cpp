@@ -0,0 +1,246 @@
+﻿#include "Components/YCRRunTelemetry.h"
+#include "YCR/Public/Enemies/EnemyBase.h"
+#include "YCR/Public/Core/YCRSimulation.h"
+#include "Async/Async.h"
+#include "EngineUtils.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Engine/World.h"
+
+namespace YCRRunTelemetry
+{
+    // Same tags the player and the checkpoint use to find pickups
+    const FName ExperienceTag = TEXT("Experience");
+    const FName ProjectileTag = TEXT("Projectile");
+}
+
+UYCRRunTelemetry::UYCRRunTelemetry()
+{
+    // Ticks only while a run is recorded, after everything else so the frame is complete
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+    PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+}
+
+void UYCRRunTelemetry::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    const float FrameMs = DeltaTime * 1000.0f;
+    FrameTimeSum += FrameMs;
+    FrameTimeMax = FMath::Max(FrameTimeMax, FrameMs);
+    FrameCount++;
+}
+
+void UYCRRunTelemetry::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (PendingExport.IsValid())
+    {
+        PendingExport.Wait();
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+// =====================================================
+// Run Lifecycle
+// =====================================================
+
+void UYCRRunTelemetry::BeginRun()
+{
+    if (!bEnabled)
+    {
+        return;
+    }
+
+    // The only allocation of the run
+    Samples.Reset();
+    Samples.SetNum(Capacity);
+    NextSampleIndex = 0;
+    NumSamples = 0;
+
+    FrameTimeSum = 0.0;
+    FrameTimeMax = 0.0f;
+    FrameCount = 0;
+    PendingKills = 0;
+    PendingDamage = 0.0f;
+    SpawnBacklog = 0;
+
+    bRecording = true;
+    SetComponentTickEnabled(true);
+}
+
+void UYCRRunTelemetry::EndRun(bool bVictory)
+{
+    if (!bRecording)
+    {
+        return;
+    }
+
+    bRecording = false;
+    SetComponentTickEnabled(false);
+
+    if (NumSamples > 0)
+    {
+        Export(bVictory);
+    }
+}
+
+void UYCRRunTelemetry::RecordSample(float RunTime)
+{
+    if (!bRecording || Samples.IsEmpty())
+    {
+        return;
+    }
+
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::Telemetry);
+
+    FYCRTelemetrySample& Sample = Samples[NextSampleIndex];
+    Sample.RunTime = RunTime;
+    Sample.AvgFrameMs = FrameCount > 0 ? static_cast<float>(FrameTimeSum / FrameCount) : 0.0f;
+    Sample.MaxFrameMs = FrameTimeMax;
+    Sample.GameThreadMs = static_cast<float>(FPlatformTime::ToMilliseconds(GGameThreadTime));
+    Sample.Kills = PendingKills;
+    Sample.Damage = PendingDamage;
+    Sample.SpawnBacklog = SpawnBacklog;
+    Sample.UsedMemoryMB = static_cast<float>(FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+    CountActors(Sample);
+
+    NextSampleIndex = (NextSampleIndex + 1) % Samples.Num();
+    NumSamples = FMath::Min(NumSamples + 1, Samples.Num());
+
+    FrameTimeSum = 0.0;
+    FrameTimeMax = 0.0f;
+    FrameCount = 0;
+    PendingKills = 0;
+    PendingDamage = 0.0f;
+}
+
+void UYCRRunTelemetry::CountActors(FYCRTelemetrySample& Sample) const
+{
+    Sample.AliveEnemies = 0;
+    Sample.Projectiles = 0;
+    Sample.Gems = 0;
+
+    // One pass over the level, no temporary arrays. Pooled actors are hidden while inactive.
+    for (FActorIterator It(GetWorld()); It; ++It)
+    {
+        const AActor* Actor = *It;
+        if (Actor->IsHidden())
+        {
+            continue;
+        }
+
+        if (const AEnemyBase* Enemy = Cast<AEnemyBase>(Actor))
+        {
+            Sample.AliveEnemies += Enemy->IsDead() ? 0 : 1;
+        }
+        else if (Actor->ActorHasTag(YCRRunTelemetry::ExperienceTag))
+        {
+            Sample.Gems++;
+        }
+        else if (Actor->ActorHasTag(YCRRunTelemetry::ProjectileTag))
+        {
+            Sample.Projectiles++;
+        }
+    }
+}
+
+void UYCRRunTelemetry::GetSamples(TArray<FYCRTelemetrySample>& OutSamples) const
+{
+    OutSamples.Reset(NumSamples);
+
+    // Oldest sample sits at the write index once the buffer has wrapped
+    const int32 First = NumSamples < Samples.Num() ? 0 : NextSampleIndex;
+    for (int32 i = 0; i < NumSamples; i++)
+    {
+        OutSamples.Add(Samples[(First + i) % Samples.Num()]);
+    }
+}
+
+// =====================================================
+// Export
+// =====================================================
+
+void UYCRRunTelemetry::Export(bool bVictory)
+{
+    if (!bExportCsv && !bExportJson)
+    {
+        return;
+    }
+
+    // Only one export in flight, a second run end in the same session is rare
+    if (PendingExport.IsValid())
+    {
+        PendingExport.Wait();
+    }
+
+    TArray<FYCRTelemetrySample> Ordered;
+    GetSamples(Ordered);
+
+    const FString BasePath = FPaths::ProjectSavedDir() / TEXT("Telemetry") /
+        FString::Printf(TEXT("Run_%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+
+    // Formatting and file IO stay off the game thread
+    PendingExport = Async(EAsyncExecution::ThreadPool,
+        [Ordered = MoveTemp(Ordered), BasePath, bVictory, bCsv = bExportCsv, bJson = bExportJson]()
+        {
+            if (bCsv)
+            {
+                FString Csv = TEXT("RunTime,AvgFrameMs,MaxFrameMs,GameThreadMs,AliveEnemies,Projectiles,Gems,Kills,Damage,SpawnBacklog,UsedMemoryMB\n");
+                Csv.Reserve(Ordered.Num() * 96);
+                for (const FYCRTelemetrySample& Sample : Ordered)
+                {
+                    Csv += FString::Printf(TEXT("%.1f,%.2f,%.2f,%.2f,%d,%d,%d,%d,%.1f,%d,%.1f\n"),
+                        Sample.RunTime, Sample.AvgFrameMs, Sample.MaxFrameMs, Sample.GameThreadMs,
+                        Sample.AliveEnemies, Sample.Projectiles, Sample.Gems, Sample.Kills, Sample.Damage,
+                        Sample.SpawnBacklog, Sample.UsedMemoryMB);
+                }
+
+                if (!FFileHelper::SaveStringToFile(Csv, *(BasePath + TEXT(".csv"))))
+                {
+                    UE_LOG(LogTemp, Error, TEXT("Failed to write run telemetry %s.csv"), *BasePath);
+                }
+            }
+
+            if (bJson)
+            {
+                FString Json;
+                TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+                    TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+
+                Writer->WriteObjectStart();
+                Writer->WriteValue(TEXT("victory"), bVictory);
+                Writer->WriteArrayStart(TEXT("samples"));
+                for (const FYCRTelemetrySample& Sample : Ordered)
+                {
+                    Writer->WriteObjectStart();
+                    Writer->WriteValue(TEXT("runTime"), Sample.RunTime);
+                    Writer->WriteValue(TEXT("avgFrameMs"), Sample.AvgFrameMs);
+                    Writer->WriteValue(TEXT("maxFrameMs"), Sample.MaxFrameMs);
+                    Writer->WriteValue(TEXT("gameThreadMs"), Sample.GameThreadMs);
+                    Writer->WriteValue(TEXT("aliveEnemies"), Sample.AliveEnemies);
+                    Writer->WriteValue(TEXT("projectiles"), Sample.Projectiles);
+                    Writer->WriteValue(TEXT("gems"), Sample.Gems);
+                    Writer->WriteValue(TEXT("kills"), Sample.Kills);
+                    Writer->WriteValue(TEXT("damage"), Sample.Damage);
+                    Writer->WriteValue(TEXT("spawnBacklog"), Sample.SpawnBacklog);
+                    Writer->WriteValue(TEXT("usedMemoryMB"), Sample.UsedMemoryMB);
+                    Writer->WriteObjectEnd();
+                }
+                Writer->WriteArrayEnd();
+                Writer->WriteObjectEnd();
+                Writer->Close();
+
+                if (!FFileHelper::SaveStringToFile(Json, *(BasePath + TEXT(".json"))))
+                {
+                    UE_LOG(LogTemp, Error, TEXT("Failed to write run telemetry %s.json"), *BasePath);
+                }
+            }
+        });
+
+    UE_LOG(LogTemp, Log, TEXT("Exporting %d telemetry samples to %s"), NumSamples, *BasePath);
+}
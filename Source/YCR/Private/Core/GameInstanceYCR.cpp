@@ -2,9 +2,27 @@
 
 #include "YCR/Public/Core/GameInstanceYCR.h"
 #include "YCR/Public/Core/YCRSaveGame.h"
+#include "YCR/Public/Core/YCRCharacterCreator.h"
+#include "YCR/Public/Core/YCRDeveloperSettings.h"
+#include "YCR/Public/Core/YCRGameplayEventBus.h"
+#include "YCR/Public/Core/YCRHordeScalability.h"
+#include "YCR/Public/Core/YCRFallbackRandomSubsystem.h"
 #include "Kismet/GameplayStatics.h"
+#include "Engine/AssetManager.h"
 #include "Engine/World.h"
 #include "Engine/DataTable.h"
+#include "TimerManager.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/PackageName.h"
+#include "GameFramework/GameModeBase.h"
+#include "UObject/UObjectGlobals.h"
+#include "PlatformFeatures.h"
+#include "SaveGameSystem.h"
+#include "Data/YCRSaveSchema.h"
+#include "Data/YCRAchievementSet.h"
 
 UGameInstanceYCR::UGameInstanceYCR()
 {
@@ -15,8 +33,21 @@ void UGameInstanceYCR::Init()
 {
     Super::Init();
     
+    const double InitStart = FPlatformTime::Seconds();
+    
+    // Device profiles set sg.HordeQuality before this module registered the group
+    FYCRHordeScalability::ApplyQualityLevel();
+    
     // Initialize default data
     InitializeDefaultData();
+    
+    // Flat per-class lookup, so spawns and menu queries never touch the data tables
+    UYCRCharacterCreator::LoadClassTableAsync();
+    LoadAchievementSetAsync();
+    
+#if PLATFORM_DESKTOP
+    Journal.Initialize(FPaths::ProjectSavedDir() / TEXT("SaveGames") / (SaveSlotName + TEXT(".journal")));
+#endif
 
     // Try to load existing save
     LoadGameData();
@@ -24,12 +55,26 @@ void UGameInstanceYCR::Init()
     // Bind to map load events
     FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &UGameInstanceYCR::OnPreLoadMap);
     FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &UGameInstanceYCR::OnPostLoadMap);
+    
+    // Startup cost on the game thread, character data streams in afterwards
+    UE_LOG(LogTemp, Log, TEXT("Game instance initialized in %.2f ms"), (FPlatformTime::Seconds() - InitStart) * 1000.0);
 }
 
 void UGameInstanceYCR::Shutdown()
 {
-    // Auto-save on shutdown
-    SaveGameData();
+    // Write anything still inside the debounce window and wait for in-flight writes
+    FlushSaveGame();
+    
+    if (PendingCheckpointWrite.IsValid())
+    {
+        PendingCheckpointWrite.Wait();
+    }
+    
+    if (AchievementSetLoadHandle.IsValid())
+    {
+        AchievementSetLoadHandle->CancelHandle();
+        AchievementSetLoadHandle.Reset();
+    }
     
     Super::Shutdown();
 }
@@ -44,54 +89,308 @@ void UGameInstanceYCR::InitializeDefaultData()
     PlayerProgress.HighestLevelReached = 1;
 }
 
+// =====================================================
+// Save Scheduling
+// =====================================================
+
 void UGameInstanceYCR::SaveGameData()
 {
-    UYCRSaveGame* SaveGameInstance = Cast<UYCRSaveGame>(
-        UGameplayStatics::CreateSaveGameObject(UYCRSaveGame::StaticClass())
-    );
+    GetTimerManager().ClearTimer(SaveDebounceHandle);
+    bSaveDirty = true;
+    WriteSaveAsync();
+}
+
+void UGameInstanceYCR::RequestSave()
+{
+    bSaveDirty = true;
+    
+    if (SaveDebounceSeconds <= 0.0f)
+    {
+        WriteSaveAsync();
+        return;
+    }
+    
+    // First change opens the window, later changes ride along
+    FTimerManager& TimerManager = GetTimerManager();
+    if (!TimerManager.IsTimerActive(SaveDebounceHandle))
+    {
+        TimerManager.SetTimer(SaveDebounceHandle, this, &UGameInstanceYCR::WriteSaveAsync, SaveDebounceSeconds, false);
+    }
+}
+
+void UGameInstanceYCR::FlushSaveGame()
+{
+    GetTimerManager().ClearTimer(SaveDebounceHandle);
+    
+    // A failed background write is folded into the snapshot below
+    ConsumeSaveWriteResult();
+    
+    // Leave a single snapshot behind so the next start does not replay anything
+    if (!bSaveDirty && !bCompactionRequested && Journal.GetJournalSize() == 0)
+    {
+        return;
+    }
+    
+    TArray<uint8> SaveBytes;
+    if (SerializeSnapshot(SaveBytes) && WriteSaveFileAtomic(SaveSlotName, UserIndex, SaveBytes))
+    {
+        FYCRProgressJournal::DeleteJournalFile(Journal.GetFilePath());
+        Journal.OnCompacted();
+        bSaveDirty = false;
+        bCompactionRequested = false;
+        UE_LOG(LogTemp, Log, TEXT("Game progress compacted into snapshot (journal sequence %lld)"),
+            Journal.GetLastSequence());
+    }
+}
+
+void UGameInstanceYCR::RecordProgress(FYCRJournalRecord Record)
+{
+    Record.ApplyTo(PlayerProgress);
+    Journal.Append(Record);
+    RequestSave();
+}
+
+void UGameInstanceYCR::PostCurrencyChanged(EYCRCurrency Currency, int32 NewAmount)
+{
+    if (UYCRGameplayEventBus* EventBus = GetSubsystem<UYCRGameplayEventBus>())
+    {
+        FYCRCurrencyEvent Event;
+        Event.Currency = Currency;
+        Event.NewAmount = NewAmount;
+        EventBus->Post(Event);
+    }
+}
+
+bool UGameInstanceYCR::SerializeSnapshot(TArray<uint8>& OutBytes) const
+{
+    FYCRSaveProfile Profile;
+    Profile.Progress = PlayerProgress;
+    Profile.JournalSequence = Journal.GetLastSequence();
+    Profile.LastSaveTime = FDateTime::Now();
     
-    if (SaveGameInstance)
+    FYCRSaveSchema::Write(Profile, OutBytes);
+    return OutBytes.Num() > 0;
+}
+
+void UGameInstanceYCR::WriteSaveAsync()
+{
+    if (!bSaveDirty && !bCompactionRequested)
+    {
+        return;
+    }
+    
+    // Never run two writes against the same slot - try again once the current one is done
+    if (PendingSaveWrite.IsValid() && !PendingSaveWrite.IsReady())
     {
-        SaveGameInstance->SavedProgress = PlayerProgress;
-        SaveGameInstance->LastSaveTime = FDateTime::Now();
+        GetTimerManager().SetTimer(SaveDebounceHandle, this, &UGameInstanceYCR::WriteSaveAsync,
+            FMath::Max(SaveDebounceSeconds, 0.1f), false);
+        return;
+    }
+    
+    // Result of the previous write (normally already handled by OnSaveWriteFinished)
+    ConsumeSaveWriteResult();
+    
+    bSaveDirty = false;
+    
+    const bool bCompact = bCompactionRequested || !Journal.IsEnabled() || Journal.GetJournalSize() >= MaxJournalBytes;
+    if (!bCompact)
+    {
+        // Common case: only the records of this window hit the disk
+        if (!Journal.HasPending())
+        {
+            return;
+        }
+        
+        InFlightJournalBytes = Journal.TakePending();
+        bInFlightCompaction = false;
         
-        if (UGameplayStatics::SaveGameToSlot(SaveGameInstance, SaveSlotName, UserIndex))
+        PendingSaveWrite = Async(EAsyncExecution::ThreadPool,
+            [JournalPath = Journal.GetFilePath(), Bytes = InFlightJournalBytes, WeakThis = TWeakObjectPtr<UGameInstanceYCR>(this), Serial = ++SaveWriteSerial]()
+            {
+                const bool bSuccess = FYCRProgressJournal::AppendToFile(JournalPath, Bytes);
+                if (!bSuccess)
+                {
+                    UE_LOG(LogTemp, Error, TEXT("Failed to append to progress journal %s"), *JournalPath);
+                }
+                
+                AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial]()
+                {
+                    if (UGameInstanceYCR* GameInstance = WeakThis.Get())
+                    {
+                        GameInstance->OnSaveWriteFinished(Serial);
+                    }
+                });
+                return bSuccess;
+            });
+        return;
+    }
+    
+    // Compaction: serialization touches UObjects and stays on the game thread, only the disk write moves off it
+    TArray<uint8> SaveBytes;
+    if (!SerializeSnapshot(SaveBytes))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to serialize game progress"));
+        return;
+    }
+    
+    bCompactionRequested = false;
+    Journal.OnCompacted();
+    InFlightJournalBytes.Reset();
+    bInFlightCompaction = true;
+    
+    // Snapshot carries the journal sequence, so a crash before the delete only leaves records that replay skips
+    PendingSaveWrite = Async(EAsyncExecution::ThreadPool,
+        [SlotName = SaveSlotName, InUserIndex = UserIndex, JournalPath = Journal.GetFilePath(), Bytes = MoveTemp(SaveBytes),
+            WeakThis = TWeakObjectPtr<UGameInstanceYCR>(this), Serial = ++SaveWriteSerial]()
         {
-            UE_LOG(LogTemp, Log, TEXT("Game progress saved successfully at %s"), 
-                *SaveGameInstance->LastSaveTime.ToString());
+            bool bSuccess = WriteSaveFileAtomic(SlotName, InUserIndex, Bytes);
+            if (!bSuccess)
+            {
+                UE_LOG(LogTemp, Error, TEXT("Failed to write save slot %s"), *SlotName);
+            }
+            else
+            {
+                bSuccess = FYCRProgressJournal::DeleteJournalFile(JournalPath);
+            }
+            
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial]()
+            {
+                if (UGameInstanceYCR* GameInstance = WeakThis.Get())
+                {
+                    GameInstance->OnSaveWriteFinished(Serial);
+                }
+            });
+            return bSuccess;
+        });
+}
+
+bool UGameInstanceYCR::ConsumeSaveWriteResult()
+{
+    if (!PendingSaveWrite.IsValid())
+    {
+        return true;
+    }
+    
+    // Completion may run before the future is set, Get() covers that gap
+    const bool bSuccess = PendingSaveWrite.Get();
+    PendingSaveWrite.Reset();
+    
+    if (!bSuccess)
+    {
+        if (!bInFlightCompaction)
+        {
+            Journal.RestorePending(MoveTemp(InFlightJournalBytes));
         }
+        
+        // A failed append can leave a torn record that hides everything after it, so the retry rewrites the snapshot
+        bCompactionRequested = true;
+        bSaveDirty = true;
     }
+    
+    InFlightJournalBytes.Reset();
+    bInFlightCompaction = false;
+    return bSuccess;
 }
 
-void UGameInstanceYCR::LoadGameData()
+void UGameInstanceYCR::OnSaveWriteFinished(uint32 Serial)
 {
-    if (UGameplayStatics::DoesSaveGameExist(SaveSlotName, UserIndex))
+    // Already consumed by a newer write or a flush
+    if (Serial != SaveWriteSerial || !PendingSaveWrite.IsValid())
+    {
+        return;
+    }
+    
+    if (!ConsumeSaveWriteResult())
     {
-        UYCRSaveGame* LoadedGame = Cast<UYCRSaveGame>(
-            UGameplayStatics::LoadGameFromSlot(SaveSlotName, UserIndex)
-        );
+        GetTimerManager().SetTimer(SaveDebounceHandle, this, &UGameInstanceYCR::WriteSaveAsync,
+            FMath::Max(SaveDebounceSeconds, 1.0f), false);
+    }
+}
+
+bool UGameInstanceYCR::WriteSaveFileAtomic(const FString& SlotName, int32 InUserIndex, const TArray<uint8>& SaveBytes)
+{
+#if PLATFORM_DESKTOP
+    // Same location the generic save system reads from in LoadGameFromSlot
+    const FString FinalPath = FPaths::ProjectSavedDir() / TEXT("SaveGames") / (SlotName + TEXT(".sav"));
+    const FString TempPath = FinalPath + TEXT(".tmp");
+    
+    if (!FFileHelper::SaveArrayToFile(SaveBytes, *TempPath))
+    {
+        return false;
+    }
+    
+    // Rename replaces the old save in one step, a crash leaves either the old or the new file
+    return IFileManager::Get().Move(*FinalPath, *TempPath, true, true);
+#else
+    // Console save systems commit atomically on their own
+    ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+    return SaveSystem && SaveSystem->SaveGame(false, *SlotName, InUserIndex, SaveBytes);
+#endif
+}
 
-        if (LoadedGame)
+void UGameInstanceYCR::LoadGameData()
+{
+    // A write in flight would otherwise be read half-finished
+    if (PendingSaveWrite.IsValid())
+    {
+        PendingSaveWrite.Wait();
+    }
+    
+    ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+    TArray<uint8> SaveBytes;
+    if (SaveSystem && SaveSystem->DoesSaveGameExist(*SaveSlotName, UserIndex) &&
+        SaveSystem->LoadGame(false, *SaveSlotName, UserIndex, SaveBytes))
+    {
+        const double LoadStart = FPlatformTime::Seconds();
+        FYCRSaveProfile Profile;
+        if (FYCRSaveSchema::Read(SaveBytes, Profile))
         {
-            // Version check für zukünftige Kompatibilität
-            if (LoadedGame->SaveVersion == 1)
+            const double LoadMs = (FPlatformTime::Seconds() - LoadStart) * 1000.0;
+            PlayerProgress = MoveTemp(Profile.Progress);
+            UE_LOG(LogTemp, Log, TEXT("Game progress loaded successfully from %s (version %d, %d bytes, %.3f ms)"), 
+                *Profile.LastSaveTime.ToString(), static_cast<int32>(Profile.LoadedVersion), SaveBytes.Num(), LoadMs);
+            
+            if (LoadMs > FYCRSaveSchema::LoadBudgetMs)
             {
-                PlayerProgress = LoadedGame->SavedProgress;
-                UE_LOG(LogTemp, Log, TEXT("Game progress loaded successfully from %s"), 
-                    *LoadedGame->LastSaveTime.ToString());
+                UE_LOG(LogTemp, Warning, TEXT("Save load took %.3f ms, budget is %.2f ms"), LoadMs, FYCRSaveSchema::LoadBudgetMs);
             }
-            else
+            
+            // Changes made after the snapshot was written
+            const int32 ReplayedCount = Journal.Replay(Profile.JournalSequence, PlayerProgress);
+            if (ReplayedCount > 0)
+            {
+                UE_LOG(LogTemp, Log, TEXT("Replayed %d progress journal records"), ReplayedCount);
+            }
+            
+            // Rewrite migrated saves in the latest format right away
+            if (ReplayedCount > 0 || Profile.LoadedVersion != EYCRSaveVersion::Latest)
             {
-                UE_LOG(LogTemp, Warning, TEXT("Save file version mismatch. Expected: 1, Got: %d"), 
-                    LoadedGame->SaveVersion);
+                bCompactionRequested = true;
+                RequestSave();
             }
         }
+        else
+        {
+            // Keep the unreadable file around, the next save overwrites the slot
+            UE_LOG(LogTemp, Error, TEXT("Could not read save slot %s, starting with default progress"), *SaveSlotName);
+            SaveSystem->SaveGame(false, *(SaveSlotName + TEXT("_Unreadable")), UserIndex, SaveBytes);
+            InitializeDefaultData();
+        }
     }
     else
     {
         UE_LOG(LogTemp, Log, TEXT("No save game found, using default values"));
         InitializeDefaultData();
+        
+        // Journal written before the first snapshot ever was
+        if (Journal.Replay(0, PlayerProgress) > 0)
+        {
+            bCompactionRequested = true;
+            RequestSave();
+        }
     }
+    
+    SyncAchievementTracker();
 }
 
 bool UGameInstanceYCR::DoesSaveGameExist() const
@@ -103,68 +402,251 @@ void UGameInstanceYCR::ResetProgress()
 {
     PlayerProgress = FPlayerProgressData();
     InitializeDefaultData();
+    SyncAchievementTracker();
+    bCompactionRequested = true;
     SaveGameData();
 }
 
-void UGameInstanceYCR::StartNewRun(const FString& SelectedCharacterClass)
+void UGameInstanceYCR::SetNextRunSeed(int32 Seed)
+{
+    NextRunSeed = Seed;
+}
+
+void UGameInstanceYCR::StartNewRun(const FString& SelectedCharacterClass, bool bUseSeed, int32 Seed)
 {
-    // Reset run data
+    // Reset run data, keeping the level the menu or the previous level's victory selected
+    const int32 SelectedLevel = CurrentRunData.CurrentLevel;
     CurrentRunData = FCurrentRunData();
-    CurrentRunData.SelectedCharacter = SelectedCharacterClass;
+    CurrentRunData.CurrentLevel = SelectedLevel;
+    CurrentRunData.SelectedCharacter = FName(*SelectedCharacterClass);
     CurrentRunData.RunStartTime = FDateTime::Now();
+    AchievementTracker.ResetRunCounters();
+    AchievementTracker.SetCounter(EYCRAchievementCounter::RunLevel, CurrentRunData.CurrentLevel);
+    
+    // Seed: explicit > requested for this run > command line > random. Any value is a valid seed, 0 included.
+    if (!bUseSeed)
+    {
+        if (NextRunSeed.IsSet())
+        {
+            Seed = NextRunSeed.GetValue();
+        }
+        else if (!FParse::Value(FCommandLine::Get(), TEXT("YCRSeed="), Seed))
+        {
+            Seed = static_cast<int32>(FPlatformTime::Cycles() ^ FMath::Rand());
+        }
+    }
+    NextRunSeed.Reset();
+    InitializeRandomStreams(Seed);
     
     // Initialize run with character
-    UE_LOG(LogTemp, Log, TEXT("Starting new run with character: %s"), *SelectedCharacterClass);
+    UE_LOG(LogTemp, Log, TEXT("Starting new run with character: %s (seed %d, replay with -YCRSeed=%d)"), 
+        *SelectedCharacterClass, Seed, Seed);
 }
 
-void UGameInstanceYCR::EndCurrentRun(bool bVictory)
+void UGameInstanceYCR::InitializeRandomStreams(int32 Seed)
 {
-    // Calculate run statistics
-    FTimespan RunDuration = FDateTime::Now() - CurrentRunData.RunStartTime;
+    CurrentRunData.RunSeed = Seed;
     
-    // Update player progress
-    if (bVictory)
+    // Derive an independent stream per system so e.g. extra loot rolls never shift spawn positions
+    for (int32 Index = 0; Index < RandomStreams.Num(); Index++)
     {
-        PlayerProgress.TotalRunsWon++;
-        
-        // Update highest level reached
-        if (CurrentRunData.CurrentLevel > PlayerProgress.HighestLevelReached)
+        RandomStreams[Index].Initialize(static_cast<int32>(HashCombine(GetTypeHash(Seed), GetTypeHash(Index))));
+    }
+}
+
+FRandomStream& UGameInstanceYCR::GetRandomStream(const UObject* WorldContextObject, EYCRRandomStream Stream)
+{
+    const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    if (UGameInstanceYCR* GameInstance = World ? World->GetGameInstance<UGameInstanceYCR>() : nullptr)
+    {
+        return GameInstance->GetRandomStream(Stream);
+    }
+    
+    // Not in a YCR game (editor preview, tools) - deterministic per world, but not per run
+    if (UYCRFallbackRandomSubsystem* Fallback = World ? World->GetSubsystem<UYCRFallbackRandomSubsystem>() : nullptr)
+    {
+        return Fallback->GetStream();
+    }
+    
+    // No world at all: a fresh stream per call, nothing is shared
+    thread_local FRandomStream NoWorldStream;
+    NoWorldStream.Initialize(0);
+    return NoWorldStream;
+}
+
+// =====================================================
+// Run Checkpoint
+// =====================================================
+
+bool UGameInstanceYCR::HasRunCheckpoint() const
+{
+    ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+    return SaveSystem && SaveSystem->DoesSaveGameExist(*RunCheckpointSlotName, UserIndex);
+}
+
+bool UGameInstanceYCR::LoadRunCheckpoint()
+{
+    PendingRunCheckpoint.Reset();
+    
+    if (PendingCheckpointWrite.IsValid())
+    {
+        PendingCheckpointWrite.Wait();
+    }
+    
+    ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem();
+    TArray<uint8> Blob;
+    if (!SaveSystem || !SaveSystem->DoesSaveGameExist(*RunCheckpointSlotName, UserIndex) ||
+        !SaveSystem->LoadGame(false, *RunCheckpointSlotName, UserIndex, Blob))
+    {
+        return false;
+    }
+    
+    const double LoadStart = FPlatformTime::Seconds();
+    FYCRRunCheckpoint Checkpoint;
+    if (!FYCRRunCheckpoint::Decode(Blob, Checkpoint))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Run checkpoint is unreadable, discarding it"));
+        DeleteRunCheckpoint();
+        return false;
+    }
+    
+    UE_LOG(LogTemp, Log, TEXT("Run checkpoint loaded (%s, %.0f s, %d enemies, %d gems, %d bytes, %.3f ms)"),
+        *Checkpoint.RunData.SelectedCharacter.ToString(), Checkpoint.RunTime, Checkpoint.Enemies.Num(),
+        Checkpoint.Gems.Num(), Blob.Num(), (FPlatformTime::Seconds() - LoadStart) * 1000.0);
+    
+    PendingRunCheckpoint.Emplace(MoveTemp(Checkpoint));
+    return true;
+}
+
+bool UGameInstanceYCR::TakePendingRunCheckpoint(FYCRRunCheckpoint& OutCheckpoint)
+{
+    if (!PendingRunCheckpoint.IsSet())
+    {
+        return false;
+    }
+    
+    OutCheckpoint = MoveTemp(PendingRunCheckpoint.GetValue());
+    PendingRunCheckpoint.Reset();
+    return true;
+}
+
+void UGameInstanceYCR::ResumeRun(const FYCRRunCheckpoint& Checkpoint)
+{
+    CurrentRunData = Checkpoint.RunData;
+    
+    // Wall clock duration continues where the run stopped
+    CurrentRunData.RunStartTime = FDateTime::Now() - FTimespan::FromSeconds(Checkpoint.RunTime);
+    
+    AchievementTracker.ResetRunCounters();
+    AchievementTracker.SetCounter(EYCRAchievementCounter::RunLevel, CurrentRunData.CurrentLevel);
+    AchievementTracker.SetCounter(EYCRAchievementCounter::RunMonstersKilled, CurrentRunData.MonstersKilled);
+    AchievementTracker.SetCounter(EYCRAchievementCounter::RunElitesKilled, CurrentRunData.ElitesKilled);
+    AchievementTracker.SetCounter(EYCRAchievementCounter::RunBossesKilled, CurrentRunData.BossesKilled);
+    AchievementTracker.SetCounter(EYCRAchievementCounter::RunGoldCollected, CurrentRunData.GoldCollected);
+    
+    // Continue every stream from its checkpointed position instead of re-deriving from the run seed
+    InitializeRandomStreams(CurrentRunData.RunSeed);
+    if (Checkpoint.RandomStreamSeeds.Num() == RandomStreams.Num())
+    {
+        for (int32 Index = 0; Index < RandomStreams.Num(); Index++)
         {
-            PlayerProgress.HighestLevelReached = CurrentRunData.CurrentLevel;
+            RandomStreams[Index].Initialize(Checkpoint.RandomStreamSeeds[Index]);
         }
     }
     
-    PlayerProgress.TotalRunsPlayed++;
-    PlayerProgress.TotalMonstersKilled += CurrentRunData.MonstersKilled;
-    PlayerProgress.TotalElitesKilled += CurrentRunData.ElitesKilled;
-    PlayerProgress.TotalBossesKilled += CurrentRunData.BossesKilled;
-    PlayerProgress.TotalGoldCollected += CurrentRunData.GoldCollected;
+    UE_LOG(LogTemp, Log, TEXT("Resuming run with character: %s at %.0f s (seed %d)"),
+        *CurrentRunData.SelectedCharacter.ToString(), Checkpoint.RunTime, CurrentRunData.RunSeed);
+}
+
+void UGameInstanceYCR::FillRunCheckpoint(FYCRRunCheckpoint& OutCheckpoint) const
+{
+    OutCheckpoint.RunData = CurrentRunData;
     
-    // Check achievements
-    CheckAndUnlockAchievements();
+    OutCheckpoint.RandomStreamSeeds.Reset(RandomStreams.Num());
+    for (const FRandomStream& Stream : RandomStreams)
+    {
+        OutCheckpoint.RandomStreamSeeds.Add(Stream.GetCurrentSeed());
+    }
+}
+
+void UGameInstanceYCR::WriteRunCheckpoint(const FYCRRunCheckpoint& Checkpoint, bool bWaitForWrite)
+{
+    if (PendingCheckpointWrite.IsValid() && !PendingCheckpointWrite.IsReady())
+    {
+        if (!bWaitForWrite)
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("Run checkpoint skipped, previous write still in flight"));
+            return;
+        }
+        PendingCheckpointWrite.Wait();
+    }
     
-    // Save progress
-    SaveGameData();
+    // Soft class paths go through the game thread's redirectors, only compression and disk move off it
+    TArray<uint8> RawBytes;
+    Checkpoint.WriteTo(RawBytes);
+    
+    PendingCheckpointWrite = Async(EAsyncExecution::ThreadPool,
+        [SlotName = RunCheckpointSlotName, InUserIndex = UserIndex, RawBytes = MoveTemp(RawBytes)]()
+        {
+            TArray<uint8> Blob;
+            if (!FYCRRunCheckpoint::Encode(RawBytes, Blob) || !WriteSaveFileAtomic(SlotName, InUserIndex, Blob))
+            {
+                UE_LOG(LogTemp, Error, TEXT("Failed to write run checkpoint %s"), *SlotName);
+                return false;
+            }
+            return true;
+        });
     
-    // Return to main menu
-    UGameplayStatics::OpenLevel(this, "MainMenu");
+    if (bWaitForWrite)
+    {
+        PendingCheckpointWrite.Wait();
+    }
 }
 
-void UGameInstanceYCR::CollectCard(const FName& CardName)
+void UGameInstanceYCR::DeleteRunCheckpoint()
 {
-    if (PlayerProgress.CollectedCards.Contains(CardName))
+    PendingRunCheckpoint.Reset();
+    
+    // A late write would bring the finished run back
+    if (PendingCheckpointWrite.IsValid())
     {
-        PlayerProgress.CollectedCards[CardName]++;
+        PendingCheckpointWrite.Wait();
+        PendingCheckpointWrite.Reset();
     }
-    else
+    
+    if (ISaveGameSystem* SaveSystem = IPlatformFeaturesModule::Get().GetSaveGameSystem())
     {
-        PlayerProgress.CollectedCards.Add(CardName, 1);
+        SaveSystem->DeleteGame(false, *RunCheckpointSlotName, UserIndex);
     }
+}
+
+void UGameInstanceYCR::EndCurrentRun(bool bVictory)
+{
+    DeleteRunCheckpoint();
     
-    UE_LOG(LogTemp, Log, TEXT("Collected card: %s (Total: %d)"), 
-        *CardName.ToString(), PlayerProgress.CollectedCards[CardName]);
+    // Update player progress
+    RecordProgress(FYCRJournalRecord::MakeRunResult(bVictory, CurrentRunData.CurrentLevel,
+        CurrentRunData.MonstersKilled, CurrentRunData.ElitesKilled, CurrentRunData.BossesKilled,
+        CurrentRunData.GoldCollected));
     
+    // Check achievements - the run clock, wall time means nothing in a fixed-step simulation
+    AchievementTracker.SetCounter(EYCRAchievementCounter::RunDurationSeconds, static_cast<int64>(CurrentRunData.RunTime));
+    AchievementTracker.SetCounter(EYCRAchievementCounter::RunCompleted, bVictory ? 1 : 0);
+    SyncLifetimeCounters();
+    CheckAndUnlockAchievements();
+    
+    // Save progress
     SaveGameData();
+    
+    // Travel (next level or main menu) is up to the game mode
+}
+
+void UGameInstanceYCR::CollectCard(const FName& CardName)
+{
+    RecordProgress(FYCRJournalRecord::MakeCollectCard(CardName));
+    
+    UE_LOG(LogTemp, Log, TEXT("Collected card: %s (Total: %d)"), 
+        *CardName.ToString(), PlayerProgress.CollectedCards[CardName]);
 }
 
 int32 UGameInstanceYCR::GetCardCount(const FName& CardName) const
@@ -175,16 +657,16 @@ int32 UGameInstanceYCR::GetCardCount(const FName& CardName) const
 
 void UGameInstanceYCR::AddEssence(int32 Amount)
 {
-    PlayerProgress.TotalEssence += Amount;
-    SaveGameData();
+    RecordProgress(FYCRJournalRecord::MakeAddEssence(Amount));
+    PostCurrencyChanged(EYCRCurrency::Essence, PlayerProgress.TotalEssence);
 }
 
 bool UGameInstanceYCR::SpendEssence(int32 Amount)
 {
     if (PlayerProgress.TotalEssence >= Amount)
     {
-        PlayerProgress.TotalEssence -= Amount;
-        SaveGameData();
+        RecordProgress(FYCRJournalRecord::MakeAddEssence(-Amount));
+        PostCurrencyChanged(EYCRCurrency::Essence, PlayerProgress.TotalEssence);
         return true;
     }
     return false;
@@ -194,8 +676,7 @@ void UGameInstanceYCR::UnlockMap(int32 MapLevel)
 {
     if (MapLevel > PlayerProgress.HighestMapUnlocked)
     {
-        PlayerProgress.HighestMapUnlocked = MapLevel;
-        SaveGameData();
+        RecordProgress(FYCRJournalRecord::MakeUnlockMap(MapLevel));
     }
 }
 
@@ -206,16 +687,7 @@ bool UGameInstanceYCR::IsMapUnlocked(int32 MapLevel) const
 
 void UGameInstanceYCR::UnlockCharacter(const FName& CharacterClass, int32 AdvancementLevel)
 {
-    if (PlayerProgress.UnlockedCharacters.Contains(CharacterClass))
-    {
-        PlayerProgress.UnlockedCharacters[CharacterClass] = 
-            FMath::Max(PlayerProgress.UnlockedCharacters[CharacterClass], AdvancementLevel);
-    }
-    else
-    {
-        PlayerProgress.UnlockedCharacters.Add(CharacterClass, AdvancementLevel);
-    }
-    SaveGameData();
+    RecordProgress(FYCRJournalRecord::MakeUnlockCharacter(CharacterClass, AdvancementLevel));
 }
 
 bool UGameInstanceYCR::IsCharacterUnlocked(const FName& CharacterClass) const
@@ -233,100 +705,195 @@ void UGameInstanceYCR::UnlockAchievement(const FString& AchievementID)
 {
     if (!PlayerProgress.UnlockedAchievements.Contains(AchievementID))
     {
-        PlayerProgress.UnlockedAchievements.Add(AchievementID);
+        const int32 KnownID = FYCRSaveSchema::FindAchievementID(AchievementID);
+        if (KnownID != INDEX_NONE)
+        {
+            AchievementTracker.MarkUnlocked(static_cast<EYCRAchievementID>(KnownID));
+        }
+        
+        RecordProgress(FYCRJournalRecord::MakeUnlockAchievement(AchievementID));
         
-        // Broadcast achievement unlock event
-        OnAchievementUnlocked.Broadcast(AchievementID);
+        // Achievement unlock event
+        if (UYCRGameplayEventBus* EventBus = GetSubsystem<UYCRGameplayEventBus>())
+        {
+            FYCRAchievementUnlockedEvent Event;
+            Event.AchievementID = FName(*AchievementID);
+            EventBus->Post(Event);
+        }
         
         UE_LOG(LogTemp, Log, TEXT("Achievement Unlocked: %s"), *AchievementID);
-        SaveGameData();
     }
 }
 
 bool UGameInstanceYCR::IsAchievementUnlocked(const FString& AchievementID) const
 {
-    return PlayerProgress.UnlockedAchievements.Contains(AchievementID);
+    const int32 KnownID = FYCRSaveSchema::FindAchievementID(AchievementID);
+    return KnownID != INDEX_NONE
+        ? AchievementTracker.IsUnlocked(static_cast<EYCRAchievementID>(KnownID))
+        : PlayerProgress.UnlockedAchievements.Contains(AchievementID);
 }
 
-TArray<FString> UGameInstanceYCR::GetUnlockedAchievements() const
+bool UGameInstanceYCR::IsAchievementIDUnlocked(EYCRAchievementID AchievementID) const
 {
-    return PlayerProgress.UnlockedAchievements.Array();
+    return AchievementTracker.IsUnlocked(AchievementID);
 }
 
-void UGameInstanceYCR::TransitionToMap(const FName& MapName)
+void UGameInstanceYCR::AddToAchievementCounter(FName CounterName, int32 Delta)
 {
-    UGameplayStatics::OpenLevel(this, MapName);
+    AchievementTracker.AddToCounter(AchievementTracker.GetCounterHandle(CounterName), Delta);
+    CheckAndUnlockAchievements();
 }
 
-void UGameInstanceYCR::OnPreLoadMap(const FString& MapName)
+TArray<FString> UGameInstanceYCR::GetUnlockedAchievements() const
 {
-    // Save current run state before transition
-    UE_LOG(LogTemp, Log, TEXT("Transitioning to map: %s"), *MapName);
+    return PlayerProgress.UnlockedAchievements.Array();
 }
 
-void UGameInstanceYCR::OnPostLoadMap(UWorld* World)
+void UGameInstanceYCR::TransitionToMap(const FName& MapName)
 {
-    if (!World)
+    UWorld* World = GetWorld();
+    const AGameModeBase* GameMode = World ? World->GetAuthGameMode() : nullptr;
+    
+    // Seamless travel loads the destination asynchronously while the transition map is up
+    if (GameMode && GameMode->bUseSeamlessTravel)
     {
+        const FString PackageName = UYCRDeveloperSettings::Get()->GetMapPackageName(MapName);
+        UE_LOG(LogTemp, Log, TEXT("Seamless travel to %s%s"), *PackageName,
+            IsMapPreloaded(MapName) ? TEXT(" (preloaded)") : TEXT(""));
+        World->ServerTravel(PackageName, true);
         return;
     }
     
-    // Restore any necessary state after map load
-    UE_LOG(LogTemp, Log, TEXT("Map loaded: %s"), *World->GetMapName());
+    UGameplayStatics::OpenLevel(this, MapName);
 }
 
-void UGameInstanceYCR::CheckAndUnlockAchievements()
+void UGameInstanceYCR::PreloadMap(const FName& MapName)
 {
-    // Beispiel Achievement Checks
-    
-    // "First Blood" - Kill 1 monster
-    if (CurrentRunData.MonstersKilled >= 1 && !IsAchievementUnlocked("FirstBlood"))
+    if (MapName.IsNone() || MapName == PreloadedMapName)
     {
-        UnlockAchievement("FirstBlood");
+        return;
     }
     
-    // "Monster Hunter" - Kill 100 monsters in one run
-    if (CurrentRunData.MonstersKilled >= 100 && !IsAchievementUnlocked("MonsterHunter"))
+    const FString PackageName = UYCRDeveloperSettings::Get()->GetMapPackageName(MapName);
+    if (!FPackageName::IsValidLongPackageName(PackageName) || !FPackageName::DoesPackageExist(PackageName))
     {
-        UnlockAchievement("MonsterHunter");
+        UE_LOG(LogTemp, Warning, TEXT("Cannot preload map %s: %s not found (check MapDirectory in the YCR settings)"),
+            *MapName.ToString(), *PackageName);
+        return;
     }
     
-    // "Elite Slayer" - Kill 10 elites in one run
-    if (CurrentRunData.ElitesKilled >= 10 && !IsAchievementUnlocked("EliteSlayer"))
+    PreloadedMapName = MapName;
+    PreloadedMapWorld = nullptr;
+    
+    LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateUObject(this, &UGameInstanceYCR::OnMapPreloaded));
+}
+
+void UGameInstanceYCR::OnMapPreloaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result)
+{
+    // Superseded by a newer request
+    if (!PreloadedMapName.IsNone() && UYCRDeveloperSettings::Get()->GetMapPackageName(PreloadedMapName) != PackageName.ToString())
     {
-        UnlockAchievement("EliteSlayer");
+        return;
     }
     
-    // "Boss Killer" - Kill your first boss
-    if (CurrentRunData.BossesKilled >= 1 && !IsAchievementUnlocked("BossKiller"))
+    if (Result != EAsyncLoadingResult::Succeeded || !LoadedPackage)
     {
-        UnlockAchievement("BossKiller");
+        UE_LOG(LogTemp, Warning, TEXT("Preloading map %s failed"), *PackageName.ToString());
+        PreloadedMapName = NAME_None;
+        return;
     }
     
-    // "Rich" - Collect 1000 gold in one run
-    if (CurrentRunData.GoldCollected >= 1000 && !IsAchievementUnlocked("Rich"))
+    // Referencing the world keeps the loaded package from being collected before the travel
+    PreloadedMapWorld = UWorld::FindWorldInPackage(LoadedPackage);
+    UE_LOG(LogTemp, Log, TEXT("Preloaded map %s"), *PackageName.ToString());
+}
+
+void UGameInstanceYCR::OnPreLoadMap(const FString& MapName)
+{
+    // Save current run state before transition
+    UE_LOG(LogTemp, Log, TEXT("Transitioning to map: %s"), *MapName);
+}
+
+void UGameInstanceYCR::OnPostLoadMap(UWorld* World)
+{
+    if (!World)
     {
-        UnlockAchievement("Rich");
+        return;
     }
     
-    // "Speedrunner" - Complete a level in under 5 minutes
-    FTimespan RunTime = FDateTime::Now() - CurrentRunData.RunStartTime;
-    if (RunTime.GetTotalMinutes() < 5.0 && CurrentRunData.CurrentLevel > 1 && 
-        !IsAchievementUnlocked("Speedrunner"))
+    // Arriving at the preloaded map hands it over; the transition map in between must not drop it
+    if (World == PreloadedMapWorld || !World->IsInSeamlessTravel())
     {
-        UnlockAchievement("Speedrunner");
+        PreloadedMapName = NAME_None;
+        PreloadedMapWorld = nullptr;
     }
     
-    // Total progress achievements
-    if (PlayerProgress.TotalMonstersKilled >= 1000 && !IsAchievementUnlocked("Exterminator"))
+    // Restore any necessary state after map load
+    UE_LOG(LogTemp, Log, TEXT("Map loaded: %s"), *World->GetMapName());
+}
+
+void UGameInstanceYCR::CheckAndUnlockAchievements()
+{
+    // Only achievements whose counters changed since the last check are evaluated
+    TArray<EYCRAchievementID> NewlyUnlocked;
+    AchievementTracker.Evaluate(NewlyUnlocked);
+    
+    for (const EYCRAchievementID AchievementID : NewlyUnlocked)
+    {
+        UnlockAchievement(FYCRSaveSchema::GetAchievementName(static_cast<uint8>(AchievementID)));
+    }
+}
+
+void UGameInstanceYCR::LoadAchievementSetAsync()
+{
+    if (AchievementSet.IsNull())
     {
-        UnlockAchievement("Exterminator");
+        AchievementTracker.Compile(*GetDefault<UYCRAchievementSet>());
+        return;
     }
     
-    if (PlayerProgress.TotalRunsWon >= 10 && !IsAchievementUnlocked("Veteran"))
+    // Counters and unlocks seeded from the save survive the compile, which re-checks every definition
+    const double RequestTime = FPlatformTime::Seconds();
+    AchievementSetLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AchievementSet.ToSoftObjectPath(),
+        FStreamableDelegate::CreateWeakLambda(this, [this, RequestTime]()
+        {
+            UE_LOG(LogTemp, Log, TEXT("Achievement set resident %.1f ms after request"),
+                (FPlatformTime::Seconds() - RequestTime) * 1000.0);
+            
+            const UYCRAchievementSet* Achievements = AchievementSet.Get();
+            if (!Achievements)
+            {
+                UE_LOG(LogTemp, Warning, TEXT("Achievement set %s failed to load, using the built-in set"),
+                    *AchievementSet.ToString());
+            }
+            AchievementTracker.Compile(Achievements ? *Achievements : *GetDefault<UYCRAchievementSet>());
+            AchievementSetLoadHandle.Reset();
+        }));
+}
+
+void UGameInstanceYCR::SyncAchievementTracker()
+{
+    AchievementTracker.ResetUnlocks();
+    for (const FString& Achievement : PlayerProgress.UnlockedAchievements)
     {
-        UnlockAchievement("Veteran");
+        const int32 KnownID = FYCRSaveSchema::FindAchievementID(Achievement);
+        if (KnownID != INDEX_NONE)
+        {
+            AchievementTracker.MarkUnlocked(static_cast<EYCRAchievementID>(KnownID));
+        }
     }
+    
+    SyncLifetimeCounters();
+}
+
+void UGameInstanceYCR::SyncLifetimeCounters()
+{
+    AchievementTracker.SetCounter(EYCRAchievementCounter::TotalMonstersKilled, PlayerProgress.TotalMonstersKilled);
+    AchievementTracker.SetCounter(EYCRAchievementCounter::TotalElitesKilled, PlayerProgress.TotalElitesKilled);
+    AchievementTracker.SetCounter(EYCRAchievementCounter::TotalBossesKilled, PlayerProgress.TotalBossesKilled);
+    AchievementTracker.SetCounter(EYCRAchievementCounter::TotalGoldCollected, PlayerProgress.TotalGoldCollected);
+    AchievementTracker.SetCounter(EYCRAchievementCounter::TotalRunsPlayed, PlayerProgress.TotalRunsPlayed);
+    AchievementTracker.SetCounter(EYCRAchievementCounter::TotalRunsWon, PlayerProgress.TotalRunsWon);
 }
 
 // Getter Methods for UI/Stats
@@ -346,18 +913,30 @@ const FCurrentRunData& UGameInstanceYCR::GetCurrentRunData() const
 }
 
 void UGameInstanceYCR::UpdateRunStats(int32 MonstersKilled, int32 ElitesKilled, 
-    int32 BossesKilled, int32 GoldCollected)
+    int32 BossesKilled, int32 GoldCollected, int32 ExperienceCollected)
 {
     CurrentRunData.MonstersKilled += MonstersKilled;
     CurrentRunData.ElitesKilled += ElitesKilled;
     CurrentRunData.BossesKilled += BossesKilled;
     CurrentRunData.GoldCollected += GoldCollected;
+    CurrentRunData.ExperienceCollected += ExperienceCollected;
     
-    // Broadcast currency change if needed
-    OnCurrencyChanged.Broadcast(CurrentRunData.GoldCollected);
+    // Mid-run achievement checks, cheap because only dependents of changed counters are evaluated
+    AchievementTracker.AddToCounter(EYCRAchievementCounter::RunMonstersKilled, MonstersKilled);
+    AchievementTracker.AddToCounter(EYCRAchievementCounter::RunElitesKilled, ElitesKilled);
+    AchievementTracker.AddToCounter(EYCRAchievementCounter::RunBossesKilled, BossesKilled);
+    AchievementTracker.AddToCounter(EYCRAchievementCounter::RunGoldCollected, GoldCollected);
+    CheckAndUnlockAchievements();
+    
+    // Currency change event if needed
+    if (GoldCollected != 0)
+    {
+        PostCurrencyChanged(EYCRCurrency::Gold, CurrentRunData.GoldCollected);
+    }
 }
 
 void UGameInstanceYCR::SetCurrentLevel(int32 Level)
 {
     CurrentRunData.CurrentLevel = Level;
+    AchievementTracker.SetCounter(EYCRAchievementCounter::RunLevel, Level);
 }
\ No newline at end of file
@@ -3,11 +3,23 @@
 #include "YCR/Public/Core/InGameMode.h"
 #include "YCR/Public/Core/InGameState.h"
 #include "YCR/Public/Core/GameInstanceYCR.h"
+#include "YCR/Public/Core/YCRSimulation.h"
+#include "YCR/Public/Core/YCRDeveloperSettings.h"
+#include "YCR/Public/Core/YCRBenchmarkPlayerController.h"
+#include "YCR/Public/Core/YCRGameplayEventBus.h"
+#include "YCR/Public/Core/YCRHordeScalability.h"
+#include "YCR/Public/Core/YCRActorPoolSubsystem.h"
 #include "YCR/Public/Character/CharacterPlayer.h"
 #include "YCR/Public/Enemies/EnemyBase.h"
 #include "YCR/Public/Systems/YCRSpawnManager.h"
 #include "YCR/Public/Systems/YCRWaveManager.h"
+#include "YCR/Public/Components/YCRRewardAggregator.h"
+#include "YCR/Public/Components/YCRRunCheckpointComponent.h"
+#include "YCR/Public/Components/YCRRunTelemetry.h"
+#include "YCR/Public/Components/YCRPrewarmScheduler.h"
+#include "YCR/Public/Components/YCREnemyBudgetController.h"
 #include "Kismet/GameplayStatics.h"
+#include "EngineUtils.h"
 #include "Engine/World.h"
 
 AInGameMode::AInGameMode()
@@ -21,9 +33,17 @@ AInGameMode::AInGameMode()
     // Enable ticking
     PrimaryActorTick.bCanEverTick = true;
     
+    // Level -> level and level -> menu go through the transition map
+    bUseSeamlessTravel = true;
+    
     // Create components
     SpawnManager = CreateDefaultSubobject<UYCRSpawnManager>(TEXT("SpawnManager"));
     WaveManager = CreateDefaultSubobject<UYCRWaveManager>(TEXT("WaveManager"));
+    RewardAggregator = CreateDefaultSubobject<UYCRRewardAggregator>(TEXT("RewardAggregator"));
+    RunCheckpoint = CreateDefaultSubobject<UYCRRunCheckpointComponent>(TEXT("RunCheckpoint"));
+    RunTelemetry = CreateDefaultSubobject<UYCRRunTelemetry>(TEXT("RunTelemetry"));
+    PrewarmScheduler = CreateDefaultSubobject<UYCRPrewarmScheduler>(TEXT("PrewarmScheduler"));
+    EnemyBudget = CreateDefaultSubobject<UYCREnemyBudgetController>(TEXT("EnemyBudget"));
 }
 
 void AInGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
@@ -31,12 +51,30 @@ void AInGameMode::InitGame(const FString& MapName, const FString& Options, FStri
     Super::InitGame(MapName, Options, ErrorMessage);
     
     UE_LOG(LogTemp, Log, TEXT("YCR InGameMode initialized for map: %s"), *MapName);
+    
+    // Must be decided before the player logs in
+    if (AYCRBenchmarkPlayerController::IsRequested())
+    {
+        PlayerControllerClass = AYCRBenchmarkPlayerController::StaticClass();
+    }
+    
+    if (FYCRSimulation::IsEnabled())
+    {
+        FYCRSimulation::Begin(GetWorld());
+    }
 }
 
 void AInGameMode::BeginPlay()
 {
     Super::BeginPlay();
     
+    // Nobody is watching a simulated run, so there is nothing to wait for
+    if (FYCRSimulation::IsEnabled())
+    {
+        StartRun();
+        return;
+    }
+    
     // Auto-start run after short delay
     FTimerHandle StartDelayHandle;
     GetWorldTimerManager().SetTimer(StartDelayHandle, this, &AInGameMode::StartRun, 2.0f, false);
@@ -46,6 +84,9 @@ void AInGameMode::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
     
+    FYCRSimulation::AddFrame();
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::RunLogic);
+    
     if (bRunActive)
     {
         UpdateRunStatistics(DeltaTime);
@@ -55,6 +96,13 @@ void AInGameMode::Tick(float DeltaTime)
 
 void AInGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    // Quitting mid-run keeps the run resumable instead of recording a loss
+    if (bRunActive && EndPlayReason == EEndPlayReason::Quit && RunCheckpoint)
+    {
+        RunCheckpoint->WriteCheckpoint(true);
+        bRunActive = false;
+    }
+    
     if (bRunActive)
     {
         EndRun(false);
@@ -73,12 +121,52 @@ void AInGameMode::StartRun()
     TotalEnemiesKilled = 0;
     CurrentEnemyCount = 0;
     bBossSpawned = false;
+    bDeathSwarmStarted = false;
     bRunActive = true;
     
     // Get game instance for run data
     if (UGameInstanceYCR* GameInstance = Cast<UGameInstanceYCR>(GetGameInstance()))
     {
-        GameInstance->StartNewRun();
+        // Continue a run loaded by ContinueRun, otherwise any old checkpoint is abandoned
+        FYCRRunCheckpoint Checkpoint;
+        if (GameInstance->TakePendingRunCheckpoint(Checkpoint))
+        {
+            GameInstance->ResumeRun(Checkpoint);
+            CurrentRunTime = Checkpoint.RunTime;
+            LastRunTimeUpdate = Checkpoint.RunTime;
+            TotalEnemiesKilled = Checkpoint.RunData.MonstersKilled;
+            bBossSpawned = Checkpoint.bBossSpawned;
+            
+            if (RunCheckpoint)
+            {
+                RunCheckpoint->BeginRestore(MoveTemp(Checkpoint));
+            }
+        }
+        else
+        {
+            GameInstance->DeleteRunCheckpoint();
+            GameInstance->StartNewRun(GameInstance->GetCurrentRunData().SelectedCharacter.ToString());
+        }
+    }
+    
+    if (RunCheckpoint)
+    {
+        RunCheckpoint->StartCheckpointing();
+    }
+    
+    if (RunTelemetry)
+    {
+        RunTelemetry->BeginRun();
+    }
+    
+    if (PrewarmScheduler)
+    {
+        PrewarmScheduler->BeginRun(CurrentRunTime);
+    }
+    
+    if (EnemyBudget)
+    {
+        EnemyBudget->BeginRun(MaxEnemyCount);
     }
     
     // Start spawning
@@ -104,6 +192,17 @@ void AInGameMode::EndRun(bool bVictory)
     
     bRunActive = false;
     
+    if (RunCheckpoint)
+    {
+        RunCheckpoint->StopCheckpointing();
+    }
+    
+    // Push last frame's rewards before the run stats are finalized
+    if (RewardAggregator)
+    {
+        RewardAggregator->Flush();
+    }
+    
     // Stop spawning
     if (SpawnManager)
     {
@@ -115,6 +214,21 @@ void AInGameMode::EndRun(bool bVictory)
         WaveManager->StopWaveProgression();
     }
     
+    if (RunTelemetry)
+    {
+        RunTelemetry->EndRun(bVictory);
+    }
+    
+    if (PrewarmScheduler)
+    {
+        PrewarmScheduler->EndRun();
+    }
+    
+    if (EnemyBudget)
+    {
+        EnemyBudget->EndRun();
+    }
+    
     // Update game instance
     if (UGameInstanceYCR* GameInstance = Cast<UGameInstanceYCR>(GetGameInstance()))
     {
@@ -124,20 +238,39 @@ void AInGameMode::EndRun(bool bVictory)
     // Broadcast completion
     OnRunCompleted.Broadcast();
     
+    // A simulated run ends the process instead of travelling
+    if (FYCRSimulation::IsEnabled())
+    {
+        FYCRSimulation::Finish(CurrentRunTime, bVictory);
+        return;
+    }
+    
     // Handle transition
-    if (bVictory)
+    UGameInstanceYCR* GameInstance = Cast<UGameInstanceYCR>(GetGameInstance());
+    const UYCRDeveloperSettings* Settings = UYCRDeveloperSettings::Get();
+    FName NextMap = Settings->MainMenuMap;
+    
+    if (bVictory && GameInstance)
     {
-        // Open portal to next level
-        // TODO: Implement portal spawning
+        // A won run moves straight on to the next level: the same timed seamless travel as the
+        // return to the menu, the preloaded map makes the switch quick. Past the last level we go home.
+        const int32 NextLevel = GameInstance->GetCurrentRunData().CurrentLevel + 1;
+        const FName NextLevelMap = Settings->GetLevelMapName(NextLevel);
+        if (!NextLevelMap.IsNone())
+        {
+            GameInstance->SetCurrentLevel(NextLevel);
+            NextMap = NextLevelMap;
+        }
     }
-    else
+    
+    // Return to menu (or move on) after delay
+    if (GameInstance)
     {
-        // Return to menu after delay
         FTimerHandle ReturnHandle;
-        GetWorldTimerManager().SetTimer(ReturnHandle, [this]()
+        GetWorldTimerManager().SetTimer(ReturnHandle, FTimerDelegate::CreateWeakLambda(GameInstance, [GameInstance, NextMap]()
         {
-            UGameplayStatics::OpenLevel(this, "MainMenu");
-        }, 3.0f, false);
+            GameInstance->TransitionToMap(NextMap);
+        }), 3.0f, false);
     }
 }
 
@@ -151,28 +284,59 @@ void AInGameMode::OnEnemyKilled(AEnemyBase* KilledEnemy)
     TotalEnemiesKilled++;
     CurrentEnemyCount = FMath::Max(0, CurrentEnemyCount - 1);
     
-    // Update game instance
-    if (UGameInstanceYCR* GameInstance = Cast<UGameInstanceYCR>(GetGameInstance()))
+    // Game instance is updated once per frame by the aggregator
+    if (RewardAggregator)
     {
-        GameInstance->AddKillCount(1);
-        
-        // Check if it was a boss
-        if (KilledEnemy->GetClass()->IsChildOf(BossClass))
-        {
-            OnBossDefeated();
-        }
+        RewardAggregator->RecordKill(KilledEnemy->GetMonsterType());
+    }
+    
+    if (RunTelemetry)
+    {
+        RunTelemetry->RecordKill();
+    }
+    
+    // Check if it was a boss
+    // A boss that was never loaded cannot be the one that died
+    const UClass* LoadedBossClass = BossClass.Get();
+    if (LoadedBossClass && KilledEnemy->GetClass()->IsChildOf(LoadedBossClass))
+    {
+        OnBossDefeated();
     }
 }
 
+int32 AInGameMode::GetEnemyCap() const
+{
+    return EnemyBudget && EnemyBudget->IsActive()
+        ? EnemyBudget->GetEnemyCap()
+        : FMath::Min(MaxEnemyCount, FYCRHordeScalability::GetMaxLiveEnemies());
+}
+
+void AInGameMode::OnEnemySpawned(AEnemyBase* SpawnedEnemy)
+{
+    if (SpawnedEnemy)
+    {
+        CurrentEnemyCount++;
+    }
+}
+
+bool AInGameMode::CanSpawnEnemy() const
+{
+    // Restored enemies are counted as they come back, hold new spawns until all of them are in
+    const bool bRestoring = RunCheckpoint && RunCheckpoint->IsRestoring();
+    return bRunActive && !bRestoring && CurrentEnemyCount < GetEnemyCap();
+}
+
 void AInGameMode::SpawnBoss()
 {
-    if (bBossSpawned || !BossClass)
+    if (bBossSpawned || BossClass.IsNull())
     {
         return;
     }
     
     UE_LOG(LogTemp, Warning, TEXT("Boss spawn time reached! Spawning boss..."));
     
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::Spawning);
+    
     bBossSpawned = true;
     
     // Find spawn location
@@ -180,21 +344,54 @@ void AInGameMode::SpawnBoss()
     if (ACharacterPlayer* Player = Cast<ACharacterPlayer>(UGameplayStatics::GetPlayerCharacter(this, 0)))
     {
         // Spawn boss at distance from player
-        FVector Direction = FMath::VRand();
+        FVector Direction = UGameInstanceYCR::GetRandomStream(this, EYCRRandomStream::BossPlacement).VRand();
         Direction.Z = 0;
         Direction.Normalize();
         SpawnLocation = Player->GetActorLocation() + (Direction * 2000.0f);
         SpawnLocation.Z = Player->GetActorLocation().Z;
     }
     
-    // Spawn boss
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    // Normally resident since LeadTime seconds ago
+    UClass* LoadedBossClass = BossClass.Get();
+    if (!LoadedBossClass)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Boss class %s was not prewarmed, loading synchronously"), *BossClass.ToString());
+        LoadedBossClass = BossClass.LoadSynchronous();
+    }
     
-    if (AActor* Boss = GetWorld()->SpawnActor<AActor>(BossClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams))
+    // Spawn boss - the prewarm scheduler usually left a deactivated instance in the pool
+    AActor* Boss = nullptr;
+    if (LoadedBossClass)
     {
+        if (UYCRActorPoolSubsystem* Pool = GetWorld()->GetSubsystem<UYCRActorPoolSubsystem>())
+        {
+            Boss = Pool->AcquireActor(LoadedBossClass, FTransform(SpawnLocation));
+        }
+        else
+        {
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+            Boss = GetWorld()->SpawnActor<AActor>(LoadedBossClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams);
+        }
+    }
+    
+    if (Boss)
+    {
+        OnEnemySpawned(Cast<AEnemyBase>(Boss));
         OnBossSpawned.Broadcast(Boss);
     }
+    
+    PreloadNextLevel();
+}
+
+void AInGameMode::PreloadNextLevel()
+{
+    // The boss fight is long enough to stream the next level in before the victory travel
+    if (UGameInstanceYCR* GameInstance = Cast<UGameInstanceYCR>(GetGameInstance()))
+    {
+        const int32 NextLevel = GameInstance->GetCurrentRunData().CurrentLevel + 1;
+        GameInstance->PreloadMap(UYCRDeveloperSettings::Get()->GetLevelMapName(NextLevel));
+    }
 }
 
 void AInGameMode::OnBossDefeated()
@@ -222,7 +419,23 @@ void AInGameMode::UpdateRunStatistics(float DeltaTime)
     if (CurrentRunTime - LastRunTimeUpdate >= 1.0f)
     {
         LastRunTimeUpdate = CurrentRunTime;
-        OnRunTimeUpdated.Broadcast(CurrentRunTime);
+        
+        if (UYCRGameplayEventBus* EventBus = UYCRGameplayEventBus::Get(this))
+        {
+            FYCRRunTimeEvent Event;
+            Event.RunTime = CurrentRunTime;
+            EventBus->Post(Event);
+        }
+        
+        if (RunTelemetry)
+        {
+            RunTelemetry->RecordSample(CurrentRunTime);
+        }
+        
+        if (PrewarmScheduler)
+        {
+            PrewarmScheduler->Update(CurrentRunTime);
+        }
         
         // Update game instance
         if (UGameInstanceYCR* GameInstance = Cast<UGameInstanceYCR>(GetGameInstance()))
@@ -240,9 +453,16 @@ void AInGameMode::CheckRunEvents()
         SpawnBoss();
     }
     
-    // Check time limit for death swarm
-    if (CurrentRunTime >= RunTimeLimit)
+    // Check time limit for death swarm, started once
+    if (!bDeathSwarmStarted && CurrentRunTime >= RunTimeLimit)
     {
+        bDeathSwarmStarted = true;
         StartDeathSwarm();
     }
+    
+    // A simulated player can survive the swarm, give the run a hard stop so the job always ends
+    if (FYCRSimulation::IsEnabled() && CurrentRunTime >= FYCRSimulation::GetMaxRunTime(RunTimeLimit + 60.0f))
+    {
+        EndRun(false);
+    }
 }
\ No newline at end of file
@@ -3,6 +3,11 @@
 #include "YCR/Public/Core/OutGameMode.h"
 #include "YCR/Public/Core/OutGameState.h"
 #include "YCR/Public/Core/GameInstanceYCR.h"
+#include "YCR/Public/Core/YCRCharacterCreator.h"
+#include "YCR/Public/Core/YCRDeveloperSettings.h"
+#include "YCR/Public/Data/YCRMapData.h"
+#include "YCR/Public/Data/YCRPrimaryAssetTypes.h"
+#include "Engine/AssetManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 
@@ -14,6 +19,9 @@ AOutGameMode::AOutGameMode()
     // No default pawn in menus
     DefaultPawnClass = nullptr;
     
+    // Menu -> run goes through the transition map instead of a blocking load
+    bUseSeamlessTravel = true;
+    
     // Initialize character costs
     CharacterUnlockCosts.Add("Swordsman", 0);      // Free starter
     CharacterUnlockCosts.Add("Mage", 100);
@@ -42,9 +50,76 @@ void AOutGameMode::BeginPlay()
     
     // Initialize menu state
     InitializeMenuState();
+    
+    // Menu previews, then the run content of the map the player most likely starts next
+    UAssetManager& AssetManager = UAssetManager::Get();
+    AssetManager.GetPrimaryAssetIdList(FYCRPrimaryAssetTypes::CharacterCreation, MenuAssetIds);
+    if (MenuAssetIds.Num() > 0)
+    {
+        AssetManager.LoadPrimaryAssets(MenuAssetIds, { FYCRAssetBundles::Menu });
+    }
+    
+    if (CachedGameInstance)
+    {
+        PreloadRunContent(CachedGameInstance->GetPlayerProgress().HighestMapUnlocked);
+    }
+}
+
+void AOutGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Run content stays with the asset manager and carries over into the run map
+    if (MenuAssetIds.Num() > 0 && UAssetManager::IsInitialized())
+    {
+        UAssetManager::Get().UnloadPrimaryAssets(MenuAssetIds);
+        MenuAssetIds.Reset();
+    }
+    
+    Super::EndPlay(EndPlayReason);
+}
+
+void AOutGameMode::PreloadRunContent(int32 MapLevel)
+{
+    const FName MapName = UYCRDeveloperSettings::Get()->GetMapRegion(MapLevel);
+    if (MapName.IsNone())
+    {
+        return;
+    }
+    
+    UAssetManager& AssetManager = UAssetManager::Get();
+    const FPrimaryAssetId MapId = UYCRMapData::MakePrimaryAssetId(MapName);
+    
+    // Only one map's run content at a time
+    TArray<FPrimaryAssetId> LoadedMaps;
+    AssetManager.GetPrimaryAssetsWithBundleState(LoadedMaps, { FYCRPrimaryAssetTypes::Map }, {});
+    LoadedMaps.Remove(MapId);
+    if (LoadedMaps.Num() > 0)
+    {
+        AssetManager.UnloadPrimaryAssets(LoadedMaps);
+    }
+    
+    TArray<FPrimaryAssetId> RunAssetIds;
+    AssetManager.GetPrimaryAssetIdList(FYCRPrimaryAssetTypes::Gems, RunAssetIds);
+    if (AssetManager.GetPrimaryAssetPath(MapId).IsValid())
+    {
+        RunAssetIds.Add(MapId);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Verbose, TEXT("No map data asset for %s, only gems are preloaded"), *MapName.ToString());
+    }
+    
+    if (RunAssetIds.Num() > 0)
+    {
+        AssetManager.LoadPrimaryAssets(RunAssetIds, { FYCRAssetBundles::InRun });
+    }
 }
 
-void AOutGameMode::StartNewRun(const FName& SelectedCharacter, int32 MapLevel)
+void AOutGameMode::SelectMapLevel(int32 MapLevel)
+{
+    PreloadRunContent(MapLevel);
+}
+
+void AOutGameMode::StartNewRun(const FName& SelectedCharacter, int32 MapLevel, bool bUseSeed, int32 Seed)
 {
     if (!ValidateRunParameters(SelectedCharacter, MapLevel))
     {
@@ -52,40 +127,92 @@ void AOutGameMode::StartNewRun(const FName& SelectedCharacter, int32 MapLevel)
         return;
     }
     
+    // Normally already running since selection, the load carries over into the run map
+    PrewarmCharacter(SelectedCharacter);
+    PreloadRunContent(MapLevel);
+    
     if (CachedGameInstance)
     {
         // Set run parameters
         CachedGameInstance->SetSelectedCharacter(SelectedCharacter);
         CachedGameInstance->SetCurrentLevel(MapLevel);
+        if (bUseSeed)
+        {
+            CachedGameInstance->SetNextRunSeed(Seed);
+        }
         
         // Determine map name based on level
-        int32 MapIndex = (MapLevel - 1) / 5;  // 5 levels per map
-        int32 SubLevel = ((MapLevel - 1) % 5) + 1;  // 1-5 within each map
+        const FName FullMapName = UYCRDeveloperSettings::Get()->GetLevelMapName(MapLevel);
         
-        if (MapNames.IsValidIndex(MapIndex))
+        if (!FullMapName.IsNone())
         {
-            FString FullMapName = FString::Printf(TEXT("%s_L%d"), 
-                *MapNames[MapIndex].ToString(), SubLevel);
-            
             UE_LOG(LogTemp, Log, TEXT("Starting run: Character=%s, Map=%s"), 
-                *SelectedCharacter.ToString(), *FullMapName);
+                *SelectedCharacter.ToString(), *FullMapName.ToString());
             
             // Transition to gameplay map
-            UGameplayStatics::OpenLevel(this, *FullMapName);
+            CachedGameInstance->TransitionToMap(FullMapName);
         }
     }
 }
 
-void AOutGameMode::ContinueRun()
+void AOutGameMode::SelectCharacter(const FName& CharacterClass)
 {
-    // For now, just start from last unlocked level
     if (CachedGameInstance)
     {
-        int32 HighestUnlocked = CachedGameInstance->GetPlayerProgress().HighestMapUnlocked;
-        FName LastCharacter = "Swordsman"; // TODO: Store last used character
-        
-        StartNewRun(LastCharacter, HighestUnlocked);
+        CachedGameInstance->SetSelectedCharacter(CharacterClass);
+    }
+    
+    PrewarmCharacter(CharacterClass);
+}
+
+void AOutGameMode::PrewarmCharacter(const FName& CharacterClass)
+{
+    if (CharacterClass == PrewarmedCharacter)
+    {
+        return;
+    }
+    
+    const UEnum* ClassEnum = StaticEnum<EYCRCharacterClasses>();
+    
+    // Browsing through classes should not keep every one of them resident
+    if (!PrewarmedCharacter.IsNone())
+    {
+        const int64 PreviousValue = ClassEnum->GetValueByNameString(PrewarmedCharacter.ToString());
+        if (PreviousValue != INDEX_NONE)
+        {
+            UYCRCharacterCreator::ReleaseCharacterAssets(static_cast<EYCRCharacterClasses>(PreviousValue));
+        }
     }
+    
+    PrewarmedCharacter = CharacterClass;
+    
+    const int64 ClassValue = ClassEnum->GetValueByNameString(CharacterClass.ToString());
+    if (ClassValue != INDEX_NONE)
+    {
+        UYCRCharacterCreator::PrewarmCharacterClass(static_cast<EYCRCharacterClasses>(ClassValue));
+    }
+}
+
+void AOutGameMode::ContinueRun()
+{
+    if (!CachedGameInstance)
+    {
+        return;
+    }
+    
+    // Unfinished run: InGameMode picks the loaded checkpoint up in StartRun
+    if (CachedGameInstance->LoadRunCheckpoint())
+    {
+        const FCurrentRunData& RunData = CachedGameInstance->GetPendingRunCheckpoint()->RunData;
+        StartNewRun(RunData.SelectedCharacter, RunData.CurrentLevel);
+        return;
+    }
+    
+    // Nothing to resume, start from the last unlocked level
+    int32 HighestUnlocked = CachedGameInstance->GetPlayerProgress().HighestMapUnlocked;
+    FName LastCharacter = "Swordsman";
+    
+    StartNewRun(LastCharacter, HighestUnlocked);
 }
 
 void AOutGameMode::OpenCharacterSelect()
@@ -0,0 +1,209 @@
+﻿#include "Core/YCRAchievementTracker.h"
+#include "Data/YCRAchievementSet.h"
+
+namespace YCRAchievementCounters
+{
+    // Indexed by EYCRAchievementCounter
+    const TCHAR* const BuiltinNames[] =
+    {
+        TEXT("Run.MonstersKilled"),
+        TEXT("Run.ElitesKilled"),
+        TEXT("Run.BossesKilled"),
+        TEXT("Run.GoldCollected"),
+        TEXT("Run.Level"),
+        TEXT("Run.DurationSeconds"),
+        TEXT("Run.Completed"),
+        TEXT("Total.MonstersKilled"),
+        TEXT("Total.ElitesKilled"),
+        TEXT("Total.BossesKilled"),
+        TEXT("Total.GoldCollected"),
+        TEXT("Total.RunsPlayed"),
+        TEXT("Total.RunsWon"),
+    };
+    static_assert(UE_ARRAY_COUNT(BuiltinNames) == static_cast<int32>(EYCRAchievementCounter::MAX),
+        "Every built-in counter needs a name");
+
+    const TCHAR* const RunPrefix = TEXT("Run.");
+}
+
+FYCRAchievementTracker::FYCRAchievementTracker()
+{
+    // Built-ins first so their handle equals the enum value
+    for (const TCHAR* CounterName : YCRAchievementCounters::BuiltinNames)
+    {
+        GetCounterHandle(CounterName);
+    }
+
+    UnlockedBits.Init(false, static_cast<int32>(EYCRAchievementID::MAX));
+}
+
+void FYCRAchievementTracker::Compile(const UYCRAchievementSet& AchievementSet)
+{
+    Conditions.Reset();
+    Achievements.Reset();
+    DirtyAchievements.Reset();
+    for (TArray<int32>& Dependents : DependentsByCounter)
+    {
+        Dependents.Reset();
+    }
+
+    for (const FYCRAchievementDefinition& Definition : AchievementSet.Achievements)
+    {
+        if (Definition.AchievementID == EYCRAchievementID::None || Definition.Conditions.IsEmpty())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Achievement set %s: skipping definition without ID or conditions"),
+                *AchievementSet.GetName());
+            continue;
+        }
+
+        const int32 AchievementIndex = Achievements.Num();
+        FCompiledAchievement& Achievement = Achievements.AddDefaulted_GetRef();
+        Achievement.AchievementID = Definition.AchievementID;
+        Achievement.FirstCondition = Conditions.Num();
+        Achievement.NumConditions = Definition.Conditions.Num();
+
+        for (const FYCRAchievementCondition& Condition : Definition.Conditions)
+        {
+            FCondition& Compiled = Conditions.AddDefaulted_GetRef();
+            Compiled.Counter = GetCounterHandle(Condition.Counter);
+            Compiled.bAtMost = Condition.Comparison == EYCRAchievementComparison::AtMost;
+            Compiled.Threshold = Condition.Threshold;
+
+            DependentsByCounter[Compiled.Counter].AddUnique(AchievementIndex);
+        }
+    }
+
+    // Counters may already satisfy new definitions
+    DirtyBits.Init(true, Achievements.Num());
+    for (int32 AchievementIndex = 0; AchievementIndex < Achievements.Num(); AchievementIndex++)
+    {
+        DirtyAchievements.Add(AchievementIndex);
+    }
+}
+
+// =====================================================
+// Counters
+// =====================================================
+
+int32 FYCRAchievementTracker::GetCounterHandle(const FName& CounterName)
+{
+    if (const int32* Handle = CounterHandles.Find(CounterName))
+    {
+        return *Handle;
+    }
+
+    const int32 Handle = CounterValues.Add(0);
+    DependentsByCounter.AddDefaulted();
+    CounterHandles.Add(CounterName, Handle);
+    return Handle;
+}
+
+void FYCRAchievementTracker::SetCounter(int32 Handle, int64 Value)
+{
+    if (CounterValues.IsValidIndex(Handle) && CounterValues[Handle] != Value)
+    {
+        CounterValues[Handle] = Value;
+        MarkDependentsDirty(Handle);
+    }
+}
+
+void FYCRAchievementTracker::AddToCounter(int32 Handle, int64 Delta)
+{
+    if (Delta != 0 && CounterValues.IsValidIndex(Handle))
+    {
+        CounterValues[Handle] += Delta;
+        MarkDependentsDirty(Handle);
+    }
+}
+
+int64 FYCRAchievementTracker::GetCounter(int32 Handle) const
+{
+    return CounterValues.IsValidIndex(Handle) ? CounterValues[Handle] : 0;
+}
+
+void FYCRAchievementTracker::ResetRunCounters()
+{
+    for (const TPair<FName, int32>& Counter : CounterHandles)
+    {
+        if (Counter.Key.ToString().StartsWith(YCRAchievementCounters::RunPrefix))
+        {
+            SetCounter(Counter.Value, 0);
+        }
+    }
+    
+    // The run length is only known once the run ends, keep "at most" duration checks failing until then
+    SetCounter(EYCRAchievementCounter::RunDurationSeconds, MAX_int64);
+}
+
+void FYCRAchievementTracker::MarkDependentsDirty(int32 Handle)
+{
+    for (const int32 AchievementIndex : DependentsByCounter[Handle])
+    {
+        if (!DirtyBits[AchievementIndex] && !IsUnlocked(Achievements[AchievementIndex].AchievementID))
+        {
+            DirtyBits[AchievementIndex] = true;
+            DirtyAchievements.Add(AchievementIndex);
+        }
+    }
+}
+
+// =====================================================
+// Unlocks
+// =====================================================
+
+bool FYCRAchievementTracker::IsUnlocked(EYCRAchievementID AchievementID) const
+{
+    const int32 Index = static_cast<int32>(AchievementID);
+    return UnlockedBits.IsValidIndex(Index) && UnlockedBits[Index];
+}
+
+void FYCRAchievementTracker::MarkUnlocked(EYCRAchievementID AchievementID)
+{
+    const int32 Index = static_cast<int32>(AchievementID);
+    if (UnlockedBits.IsValidIndex(Index))
+    {
+        UnlockedBits[Index] = true;
+    }
+}
+
+void FYCRAchievementTracker::ResetUnlocks()
+{
+    UnlockedBits.Init(false, static_cast<int32>(EYCRAchievementID::MAX));
+
+    DirtyBits.Init(true, Achievements.Num());
+    DirtyAchievements.Reset();
+    for (int32 AchievementIndex = 0; AchievementIndex < Achievements.Num(); AchievementIndex++)
+    {
+        DirtyAchievements.Add(AchievementIndex);
+    }
+}
+
+bool FYCRAchievementTracker::AreConditionsMet(const FCompiledAchievement& Achievement) const
+{
+    for (int32 Index = Achievement.FirstCondition; Index < Achievement.FirstCondition + Achievement.NumConditions; Index++)
+    {
+        const FCondition& Condition = Conditions[Index];
+        const int64 Value = CounterValues[Condition.Counter];
+        if (Condition.bAtMost ? Value > Condition.Threshold : Value < Condition.Threshold)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FYCRAchievementTracker::Evaluate(TArray<EYCRAchievementID>& OutNewlyUnlocked)
+{
+    for (const int32 AchievementIndex : DirtyAchievements)
+    {
+        DirtyBits[AchievementIndex] = false;
+
+        const FCompiledAchievement& Achievement = Achievements[AchievementIndex];
+        if (!IsUnlocked(Achievement.AchievementID) && AreConditionsMet(Achievement))
+        {
+            MarkUnlocked(Achievement.AchievementID);
+            OutNewlyUnlocked.Add(Achievement.AchievementID);
+        }
+    }
+    DirtyAchievements.Reset();
+}
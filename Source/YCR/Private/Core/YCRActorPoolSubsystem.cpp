@@ -0,0 +1,170 @@
+﻿#include "Core/YCRActorPoolSubsystem.h"
+#include "Core/YCRSimulation.h"
+#include "Components/ActorComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/MovementComponent.h"
+#include "Engine/World.h"
+
+void UYCRActorPoolSubsystem::Deinitialize()
+{
+    FreeActors.Empty();
+    FreeActorSet.Empty();
+
+    Super::Deinitialize();
+}
+
+AActor* UYCRActorPoolSubsystem::AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& Transform)
+{
+    if (!ActorClass)
+    {
+        return nullptr;
+    }
+
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::Spawning);
+
+    if (TArray<TWeakObjectPtr<AActor>>* Free = FreeActors.Find(ActorClass.Get()))
+    {
+        while (Free->Num() > 0)
+        {
+            const TWeakObjectPtr<AActor> Pooled = Free->Pop(EAllowShrinking::No);
+            FreeActorSet.Remove(Pooled);
+
+            AActor* Actor = Pooled.Get();
+            if (IsValid(Actor))
+            {
+                Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+                ResetVelocity(Actor);
+                SetActorActive(Actor, true);
+                return Actor;
+            }
+        }
+    }
+
+    return SpawnPooledActor(ActorClass, Transform);
+}
+
+void UYCRActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+    // Overlap queries can report the same actor once per primitive, a second release would hand it out twice
+    if (!IsValid(Actor) || FreeActorSet.Contains(Actor))
+    {
+        return;
+    }
+
+    TArray<TWeakObjectPtr<AActor>>& Free = FreeActors.FindOrAdd(Actor->GetClass());
+    if (Free.Num() >= MaxFreeActorsPerClass)
+    {
+        Actor->Destroy();
+        return;
+    }
+
+    SetActorActive(Actor, false);
+    ResetVelocity(Actor);
+    Free.Add(Actor);
+    FreeActorSet.Add(Actor);
+}
+
+void UYCRActorPoolSubsystem::PrewarmPool(TSubclassOf<AActor> ActorClass, int32 Count)
+{
+    if (!ActorClass || Count <= 0)
+    {
+        return;
+    }
+
+    TArray<TWeakObjectPtr<AActor>>& Free = FreeActors.FindOrAdd(ActorClass.Get());
+    const int32 ToSpawn = FMath::Min(Count, MaxFreeActorsPerClass) - Free.Num();
+    Free.Reserve(Free.Num() + FMath::Max(0, ToSpawn));
+
+    for (int32 i = 0; i < ToSpawn; i++)
+    {
+        if (AActor* Actor = SpawnPooledActor(ActorClass, FTransform::Identity))
+        {
+            SetActorActive(Actor, false);
+            Free.Add(Actor);
+            FreeActorSet.Add(Actor);
+        }
+    }
+}
+
+void UYCRActorPoolSubsystem::TrimPool(TSubclassOf<AActor> ActorClass)
+{
+    TArray<TWeakObjectPtr<AActor>> Free;
+    if (!ActorClass || !FreeActors.RemoveAndCopyValue(ActorClass.Get(), Free))
+    {
+        return;
+    }
+
+    for (const TWeakObjectPtr<AActor>& Actor : Free)
+    {
+        FreeActorSet.Remove(Actor);
+        if (Actor.IsValid())
+        {
+            Actor->Destroy();
+        }
+    }
+}
+
+int32 UYCRActorPoolSubsystem::GetFreeCount(TSubclassOf<AActor> ActorClass) const
+{
+    const TArray<TWeakObjectPtr<AActor>>* Free = ActorClass ? FreeActors.Find(ActorClass.Get()) : nullptr;
+    return Free ? Free->Num() : 0;
+}
+
+void UYCRActorPoolSubsystem::ReleaseOrDestroy(AActor* Actor)
+{
+    if (!IsValid(Actor))
+    {
+        return;
+    }
+
+    UWorld* World = Actor->GetWorld();
+    if (UYCRActorPoolSubsystem* Pool = World ? World->GetSubsystem<UYCRActorPoolSubsystem>() : nullptr)
+    {
+        Pool->ReleaseActor(Actor);
+    }
+    else
+    {
+        Actor->Destroy();
+    }
+}
+
+AActor* UYCRActorPoolSubsystem::SpawnPooledActor(UClass* ActorClass, const FTransform& Transform) const
+{
+    // Pooled actors (gems, pickups) may overlap each other - skip the collision adjustment pass
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    return GetWorld()->SpawnActor<AActor>(ActorClass, Transform, SpawnParams);
+}
+
+void UYCRActorPoolSubsystem::ResetVelocity(AActor* Actor)
+{
+    // A reused actor must not carry the momentum it was released with
+    for (UActorComponent* Component : Actor->GetComponents())
+    {
+        if (UMovementComponent* Movement = Cast<UMovementComponent>(Component))
+        {
+            Movement->StopMovementImmediately();
+        }
+    }
+
+    if (UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Actor->GetRootComponent()); Root && Root->IsSimulatingPhysics())
+    {
+        Root->SetPhysicsLinearVelocity(FVector::ZeroVector);
+        Root->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+    }
+}
+
+void UYCRActorPoolSubsystem::SetActorActive(AActor* Actor, bool bActive)
+{
+    Actor->SetActorHiddenInGame(!bActive);
+    Actor->SetActorEnableCollision(bActive);
+    Actor->SetActorTickEnabled(bActive);
+
+    // Components tick on their own (enemy AI keeps walking and dealing contact damage), pause them too.
+    // An acquired actor gets the tick state it was spawned with
+    for (UActorComponent* Component : Actor->GetComponents())
+    {
+        Component->SetComponentTickEnabled(bActive && Component->PrimaryComponentTick.bStartWithTickEnabled);
+    }
+}
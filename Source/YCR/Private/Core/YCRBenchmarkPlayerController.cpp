@@ -0,0 +1,229 @@
+﻿#include "Core/YCRBenchmarkPlayerController.h"
+#include "YCR/Public/Core/GameInstanceYCR.h"
+#include "YCR/Public/Core/InGameMode.h"
+#include "YCR/Public/Character/CharacterPlayer.h"
+#include "YCR/Public/Enemies/EnemyBase.h"
+#include "YCR/Public/Core/YCRInteractableRegistry.h"
+#include "YCR/Public/Core/YCRSimulation.h"
+#include "Engine/OverlapResult.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Engine/World.h"
+
+namespace YCRBenchmarkPlayerController
+{
+    // Gems are found by the same tag the player collects them by
+    const FName ExperienceTag = TEXT("Experience");
+}
+
+AYCRBenchmarkPlayerController::AYCRBenchmarkPlayerController()
+{
+    // Decide after the enemies moved this frame
+    PrimaryActorTick.TickGroup = TG_PostPhysics;
+}
+
+bool AYCRBenchmarkPlayerController::IsRequested()
+{
+    return FParse::Param(FCommandLine::Get(), TEXT("YCRBot"));
+}
+
+void AYCRBenchmarkPlayerController::OnPossess(APawn* InPawn)
+{
+    Super::OnPossess(InPawn);
+
+    OrbitCenter = InPawn ? InPawn->GetActorLocation() : FVector::ZeroVector;
+    bStarted = false;
+}
+
+void AYCRBenchmarkPlayerController::StartBot(double Now)
+{
+    // Own stream so the bot never shifts the gameplay streams. The run seed exists once the run started.
+    const UGameInstanceYCR* GameInstance = GetGameInstance<UGameInstanceYCR>();
+    BotStream.Initialize(GameInstance ? GameInstance->GetRunSeed() : 0);
+
+    OrbitSign = BotStream.FRand() < 0.5f ? -1.0f : 1.0f;
+    NextDecisionTime = Now;
+    NextOrbitFlipTime = Now + OrbitFlipInterval;
+    bStarted = true;
+
+    UE_LOG(LogTemp, Log, TEXT("Benchmark bot playing %s (seed %d)"), *GetNameSafe(GetPawn()), BotStream.GetInitialSeed());
+}
+
+void AYCRBenchmarkPlayerController::PlayerTick(float DeltaTime)
+{
+    Super::PlayerTick(DeltaTime);
+
+    ACharacterPlayer* Player = GetPawn<ACharacterPlayer>();
+    const AInGameMode* GameMode = GetWorld()->GetAuthGameMode<AInGameMode>();
+    if (!Player || Player->IsDead() || !GameMode || !GameMode->IsRunActive())
+    {
+        return;
+    }
+
+    // Game time, not wall time, so a fixed-step run makes the same decisions
+    const double Now = GetWorld()->GetTimeSeconds();
+    if (!bStarted)
+    {
+        StartBot(Now);
+    }
+
+    if (Now >= NextDecisionTime)
+    {
+        NextDecisionTime = Now + DecisionInterval;
+        Decide(Player, Now);
+    }
+
+    Player->ApplyMoveInput(CurrentInput);
+}
+
+void AYCRBenchmarkPlayerController::Decide(ACharacterPlayer* Player, double Now)
+{
+    FYCRSimulationScope SimulationScope(EYCRSimulationCost::Bot);
+
+    if (Now >= NextOrbitFlipTime)
+    {
+        NextOrbitFlipTime = Now + OrbitFlipInterval;
+        if (BotStream.FRand() < 0.5f)
+        {
+            OrbitSign = -OrbitSign;
+        }
+    }
+
+    const FVector Location = Player->GetActorLocation();
+
+    // Priority: chest, then gem, then orbit
+    FVector Goal;
+    AActor* Chest = nullptr;
+    FVector Desired;
+    if (FindChestGoal(Player, Goal, Chest))
+    {
+        if (FVector::DistSquared2D(Location, Goal) <= FMath::Square(InteractRadius))
+        {
+            Player->TryInteract();
+        }
+        Desired = (Goal - Location).GetSafeNormal2D();
+    }
+    else if (FindGemGoal(Player, Goal))
+    {
+        Desired = (Goal - Location).GetSafeNormal2D();
+    }
+    else
+    {
+        Desired = GetOrbitDirection(Location);
+    }
+
+    Desired = (Desired + GetThreatAvoidance(Location) * ThreatWeight).GetSafeNormal2D();
+
+    // Move input is relative to the control yaw, exactly like the Move action
+    const FRotator YawRotation(0.0f, GetControlRotation().Yaw, 0.0f);
+    const FVector Forward = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::X);
+    const FVector Right = FRotationMatrix(YawRotation).GetUnitAxis(EAxis::Y);
+    CurrentInput = FVector2D(FVector::DotProduct(Desired, Right), FVector::DotProduct(Desired, Forward));
+}
+
+bool AYCRBenchmarkPlayerController::FindChestGoal(const ACharacterPlayer* Player, FVector& OutGoal, AActor*& OutChest) const
+{
+    const UYCRInteractableRegistry* Registry = GetWorld()->GetSubsystem<UYCRInteractableRegistry>();
+    OutChest = Registry
+        ? Registry->FindClosestInteractable(Player->GetActorLocation(), ChestSearchRadius, const_cast<ACharacterPlayer*>(Player))
+        : nullptr;
+
+    if (OutChest)
+    {
+        OutGoal = OutChest->GetActorLocation();
+    }
+    return OutChest != nullptr;
+}
+
+bool AYCRBenchmarkPlayerController::FindGemGoal(const ACharacterPlayer* Player, FVector& OutGoal) const
+{
+    const FVector Location = Player->GetActorLocation();
+    float BestDistSq = FMath::Square(GemSearchRadius);
+    bool bFound = false;
+
+    // Same pickup channel the player collects on, only wider
+    TArray<FOverlapResult> OverlapResults;
+    FCollisionQueryParams QueryParams;
+    QueryParams.AddIgnoredActor(Player);
+    GetWorld()->OverlapMultiByChannel(OverlapResults, Location, FQuat::Identity, ECC_GameTraceChannel2,
+        FCollisionShape::MakeSphere(GemSearchRadius), QueryParams);
+
+    for (const FOverlapResult& Overlap : OverlapResults)
+    {
+        const AActor* Actor = Overlap.GetActor();
+        if (!Actor || Actor->IsHidden() || !Actor->ActorHasTag(YCRBenchmarkPlayerController::ExperienceTag))
+        {
+            continue;
+        }
+
+        const float DistSq = FVector::DistSquared2D(Location, Actor->GetActorLocation());
+        if (DistSq < BestDistSq)
+        {
+            BestDistSq = DistSq;
+            OutGoal = Actor->GetActorLocation();
+            bFound = true;
+        }
+    }
+
+    return bFound;
+}
+
+FVector AYCRBenchmarkPlayerController::GetOrbitDirection(const FVector& Location) const
+{
+    FVector Radial = Location - OrbitCenter;
+    Radial.Z = 0.0f;
+    const float Distance = Radial.Size();
+    if (Distance < KINDA_SMALL_NUMBER)
+    {
+        return FVector::ForwardVector;
+    }
+
+    Radial /= Distance;
+    const FVector Tangent = FVector(-Radial.Y, Radial.X, 0.0f) * OrbitSign;
+
+    // Pull back onto the circle when drifting off it
+    const float RadialError = (OrbitRadius - Distance) / OrbitRadius;
+    return (Tangent + Radial * FMath::Clamp(RadialError, -1.0f, 1.0f)).GetSafeNormal2D();
+}
+
+FVector AYCRBenchmarkPlayerController::GetThreatAvoidance(const FVector& Location) const
+{
+    FVector Avoidance = FVector::ZeroVector;
+    const float RadiusSq = FMath::Square(ThreatRadius);
+
+    TArray<FOverlapResult> OverlapResults;
+    FCollisionQueryParams QueryParams;
+    QueryParams.AddIgnoredActor(GetPawn());
+    GetWorld()->OverlapMultiByObjectType(OverlapResults, Location, FQuat::Identity,
+        FCollisionObjectQueryParams(ECC_Pawn), FCollisionShape::MakeSphere(ThreatRadius), QueryParams);
+
+    // Capsule and mesh both report as pawns, count each enemy once
+    TSet<const AEnemyBase*> Counted;
+    for (const FOverlapResult& Overlap : OverlapResults)
+    {
+        const AEnemyBase* Enemy = Cast<AEnemyBase>(Overlap.GetActor());
+        if (!Enemy || Enemy->IsDead() || Enemy->IsHidden())
+        {
+            continue;
+        }
+
+        bool bAlreadyCounted = false;
+        Counted.Add(Enemy, &bAlreadyCounted);
+        if (bAlreadyCounted)
+        {
+            continue;
+        }
+
+        FVector Away = Location - Enemy->GetActorLocation();
+        Away.Z = 0.0f;
+        const float DistSq = Away.SizeSquared();
+        if (DistSq < RadiusSq && DistSq > KINDA_SMALL_NUMBER)
+        {
+            // Closer enemies push harder
+            const float Distance = FMath::Sqrt(DistSq);
+            Avoidance += (Away / Distance) * (1.0f - Distance / ThreatRadius);
+        }
+    }
+
+    return Avoidance.GetClampedToMaxSize(1.0f);
+}
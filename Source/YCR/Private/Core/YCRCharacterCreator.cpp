@@ -8,32 +8,92 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Engine/World.h"
 #include "Engine/DataTable.h"
-#include "UObject/ConstructorHelpers.h"
+#include "Core/YCRDeveloperSettings.h"
+#include "Engine/AssetManager.h"
 
 // Static member initialization
-TMap<EYCRCharacterClasses, FYCRCharacterCreationData> UYCRCharacterCreator::CachedCreationData;
+FYCRCharacterClassTable UYCRCharacterCreator::ClassTable;
+TMap<EYCRCharacterClasses, TSharedPtr<FStreamableHandle>> UYCRCharacterCreator::PreloadHandles;
+TMap<EYCRCharacterClasses, TArray<FStreamableDelegate>> UYCRCharacterCreator::PendingPreloadCallbacks;
+TSharedPtr<FStreamableHandle> UYCRCharacterCreator::ClassTableLoadHandle;
 
-UYCRCharacterCreator::UYCRCharacterCreator()
+// =====================================================
+// Class Table
+// =====================================================
+
+int32 FYCRCharacterClassTable::Build(const UDataTable* CreationDataTable, const UDataTable* ClassDataTable)
 {
-    // Load the character creation data table
-    static ConstructorHelpers::FObjectFinder<UDataTable> CreationDataObject(
-        TEXT("/Game/YCR/Data/DT_CharacterCreationData")
-    );
-    
-    if (CreationDataObject.Succeeded())
+    HasCreationRow.Init(false, NumClasses);
+    HasClassRow.Init(false, NumClasses);
+    for (int32 Index = 0; Index < NumClasses; Index++)
     {
-        CharacterCreationDataTable = CreationDataObject.Object;
+        CreationData[Index] = FYCRCharacterCreationData();
+        ClassData[Index] = FCharacterClassData();
     }
-    
-    // Set default player character class
-    static ConstructorHelpers::FClassFinder<ACharacterPlayer> PlayerCharacterBPClass(
-        TEXT("/Game/YCR/Blueprints/Characters/BP_CharacterPlayer")
-    );
-    
-    if (PlayerCharacterBPClass.Succeeded())
+
+    // Row names are the enum names (e.g. "Swordsman"), resolved once here instead of per lookup
+    const UEnum* ClassEnum = StaticEnum<EYCRCharacterClasses>();
+    if (CreationDataTable)
+    {
+        for (int32 Index = 1; Index < NumClasses; Index++)
+        {
+            const FName RowName(*ClassEnum->GetNameStringByValue(Index));
+            if (const FYCRCharacterCreationData* Row = CreationDataTable->FindRow<FYCRCharacterCreationData>(RowName, FString(), false))
+            {
+                CreationData[Index] = *Row;
+                HasCreationRow[Index] = true;
+            }
+        }
+    }
+
+    if (ClassDataTable)
+    {
+        ClassDataTable->ForeachRow<FCharacterClassData>(TEXT("FYCRCharacterClassTable::Build"),
+            [this](const FName& RowName, const FCharacterClassData& Row)
+            {
+                const int32 Index = static_cast<int32>(Row.JobClassType);
+                if (Index > 0 && Index < NumClasses)
+                {
+                    ClassData[Index] = Row;
+                    HasClassRow[Index] = true;
+                }
+            });
+    }
+
+    // Every playable class needs a creation row, None has none by design
+    int32 MissingCount = 0;
+    for (int32 Index = 1; Index < NumClasses; Index++)
     {
-        PlayerCharacterClass = PlayerCharacterBPClass.Class;
+        if (!HasCreationRow[Index])
+        {
+            UE_LOG(LogTemp, Error, TEXT("YCRCharacterCreator: Class %s has no row in %s"),
+                *ClassEnum->GetNameStringByValue(Index), CreationDataTable ? *CreationDataTable->GetName() : TEXT("(no table)"));
+            MissingCount++;
+        }
     }
+
+    bBuilt = true;
+    return MissingCount;
+}
+
+bool FYCRCharacterClassTable::HasCreationData(EYCRCharacterClasses CharacterClass) const
+{
+    const int32 Index = static_cast<int32>(CharacterClass);
+    return Index >= 0 && Index < NumClasses && HasCreationRow.IsValidIndex(Index) && HasCreationRow[Index];
+}
+
+const FYCRCharacterCreationData& FYCRCharacterClassTable::GetCreationData(EYCRCharacterClasses CharacterClass) const
+{
+    const int32 Index = static_cast<int32>(CharacterClass);
+
+    // Entry 0 (None) stays a default row and doubles as the fallback
+    return HasCreationData(CharacterClass) ? CreationData[Index] : CreationData[0];
+}
+
+const FCharacterClassData* FYCRCharacterClassTable::FindClassData(EYCRCharacterClasses CharacterClass) const
+{
+    const int32 Index = static_cast<int32>(CharacterClass);
+    return Index >= 0 && Index < NumClasses && HasClassRow.IsValidIndex(Index) && HasClassRow[Index] ? &ClassData[Index] : nullptr;
 }
 
 ACharacterPlayer* UYCRCharacterCreator::CreatePlayerCharacter(
@@ -50,9 +110,16 @@ ACharacterPlayer* UYCRCharacterCreator::CreatePlayerCharacter(
         return nullptr;
     }
 
-    // Get the character creator CDO to access defaults
-    const UYCRCharacterCreator* CreatorCDO = GetDefault<UYCRCharacterCreator>();
-    if (!CreatorCDO->PlayerCharacterClass)
+    // Resident after PreloadCharacterAssets, the synchronous load is only a fallback for unprepared callers
+    const TSoftClassPtr<ACharacterPlayer>& PlayerClassRef = UYCRDeveloperSettings::Get()->PlayerCharacterClass;
+    UClass* PlayerCharacterClass = PlayerClassRef.Get();
+    if (!PlayerCharacterClass && !PlayerClassRef.IsNull())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("YCRCharacterCreator: Player character class was not preloaded, loading synchronously"));
+        PlayerCharacterClass = PlayerClassRef.LoadSynchronous();
+    }
+
+    if (!PlayerCharacterClass)
     {
         UE_LOG(LogTemp, Error, TEXT("YCRCharacterCreator: No player character class set"));
         return nullptr;
@@ -64,7 +131,7 @@ ACharacterPlayer* UYCRCharacterCreator::CreatePlayerCharacter(
 
     // Spawn the character
     ACharacterPlayer* NewCharacter = World->SpawnActor<ACharacterPlayer>(
-        CreatorCDO->PlayerCharacterClass,
+        PlayerCharacterClass,
         SpawnLocation,
         SpawnRotation,
         SpawnParams
@@ -97,20 +164,21 @@ bool UYCRCharacterCreator::InitializeCharacterWithClass(
     }
 
     // Get character creation data
-    FYCRCharacterCreationData CreationData;
-    if (!GetCharacterCreationData(CharacterClass, CreationData))
+    const FYCRCharacterClassTable& Table = GetClassTable();
+    if (!Table.HasCreationData(CharacterClass))
     {
         UE_LOG(LogTemp, Warning, TEXT("YCRCharacterCreator: No creation data found for class %s"), 
             *UEnum::GetValueAsString(CharacterClass));
         return false;
     }
+    const FYCRCharacterCreationData& CreationData = Table.GetCreationData(CharacterClass);
 
     // Set the character's class
     Character->SetCharacterClass(CharacterClass);
 
     // Apply all character data
     ApplyBaseStats(Character, CreationData);
-    ApplyCharacterVisuals(Character, CreationData);
+    ApplyCharacterVisuals(Character, CharacterClass);
     GrantStartingAbilities(Character, CreationData);
 
     // Set element affinity
@@ -127,67 +195,246 @@ bool UYCRCharacterCreator::GetCharacterCreationData(
     EYCRCharacterClasses CharacterClass,
     FYCRCharacterCreationData& OutData)
 {
-    // Check cache first
-    if (CachedCreationData.Contains(CharacterClass))
+    const FYCRCharacterClassTable& Table = GetClassTable();
+    if (!Table.HasCreationData(CharacterClass))
+    {
+        return false;
+    }
+
+    OutData = Table.GetCreationData(CharacterClass);
+    return true;
+}
+
+void UYCRCharacterCreator::GetClassTablePaths(TArray<FSoftObjectPath>& OutPaths)
+{
+    const UYCRDeveloperSettings* Settings = UYCRDeveloperSettings::Get();
+    if (!Settings->CharacterCreationDataTable.IsNull())
+    {
+        OutPaths.Add(Settings->CharacterCreationDataTable.ToSoftObjectPath());
+    }
+    if (!Settings->CharacterClassDataTable.IsNull())
+    {
+        OutPaths.Add(Settings->CharacterClassDataTable.ToSoftObjectPath());
+    }
+}
+
+void UYCRCharacterCreator::LoadClassTableAsync()
+{
+    if (ClassTable.IsBuilt() || ClassTableLoadHandle.IsValid())
+    {
+        return;
+    }
+
+    TArray<FSoftObjectPath> TablePaths;
+    GetClassTablePaths(TablePaths);
+    if (TablePaths.IsEmpty())
+    {
+        BuildClassTable();
+        return;
+    }
+
+    const double RequestTime = FPlatformTime::Seconds();
+    ClassTableLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(TablePaths,
+        FStreamableDelegate::CreateLambda([RequestTime]()
+        {
+            UE_LOG(LogTemp, Log, TEXT("YCRCharacterCreator: Class data tables resident %.1f ms after request"),
+                (FPlatformTime::Seconds() - RequestTime) * 1000.0);
+            if (!ClassTable.IsBuilt())
+            {
+                BuildClassTable();
+            }
+        }));
+}
+
+void UYCRCharacterCreator::BuildClassTable()
+{
+    const double BuildStart = FPlatformTime::Seconds();
+
+    // Resident when LoadClassTableAsync got there first, otherwise whoever needs the table now pays for the load
+    if (!ClassTableLoadHandle.IsValid() || !ClassTableLoadHandle->HasLoadCompleted())
     {
-        OutData = CachedCreationData[CharacterClass];
-        return true;
+        TArray<FSoftObjectPath> TablePaths;
+        GetClassTablePaths(TablePaths);
+        if (TablePaths.Num() > 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("YCRCharacterCreator: Class table needed before its data tables were loaded, loading synchronously"));
+            ClassTableLoadHandle = UAssetManager::GetStreamableManager().RequestSyncLoad(TablePaths);
+        }
     }
 
-    // Get the CDO to access the data table
-    const UYCRCharacterCreator* CreatorCDO = GetDefault<UYCRCharacterCreator>();
-    if (!CreatorCDO->CharacterCreationDataTable)
+    const UYCRDeveloperSettings* Settings = UYCRDeveloperSettings::Get();
+    const UDataTable* CreationDataTable = Settings->CharacterCreationDataTable.Get();
+    if (!CreationDataTable)
     {
         UE_LOG(LogTemp, Error, TEXT("YCRCharacterCreator: No character creation data table set"));
-        return false;
     }
 
-    // Convert enum to row name (e.g., Swordsman -> "Swordsman")
-    FString RowName = UEnum::GetValueAsString(CharacterClass);
-    RowName = RowName.Replace(TEXT("EYCRCharacterClass::"), TEXT(""));
+    const int32 MissingCount = ClassTable.Build(CreationDataTable, Settings->CharacterClassDataTable.Get());
 
-    // Find the row in the data table
-    FYCRCharacterCreationData* FoundData = CreatorCDO->CharacterCreationDataTable->FindRow<FYCRCharacterCreationData>(
-        FName(*RowName),
-        TEXT("YCRCharacterCreator::GetCharacterCreationData")
-    );
+    UE_LOG(LogTemp, Log, TEXT("YCRCharacterCreator: Class table built in %.3f ms (%d classes without creation data)"),
+        (FPlatformTime::Seconds() - BuildStart) * 1000.0, MissingCount);
+}
+
+const FYCRCharacterClassTable& UYCRCharacterCreator::GetClassTable()
+{
+    if (!ClassTable.IsBuilt())
+    {
+        BuildClassTable();
+    }
+    return ClassTable;
+}
+
+void UYCRCharacterCreator::GetCharacterAssetPaths(
+    const FYCRCharacterCreationData& CreationData,
+    TArray<FSoftObjectPath>& OutPaths)
+{
+    // Shared by every class, already resident after the first preload
+    const TSoftClassPtr<ACharacterPlayer>& PlayerClassRef = UYCRDeveloperSettings::Get()->PlayerCharacterClass;
+    if (!PlayerClassRef.IsNull())
+    {
+        OutPaths.Add(PlayerClassRef.ToSoftObjectPath());
+    }
+
+    if (!CreationData.CharacterMesh.IsNull())
+    {
+        OutPaths.Add(CreationData.CharacterMesh.ToSoftObjectPath());
+    }
+
+    if (!CreationData.AnimationBlueprint.IsNull())
+    {
+        OutPaths.Add(CreationData.AnimationBlueprint.ToSoftObjectPath());
+    }
+}
+
+TSharedPtr<FStreamableHandle> UYCRCharacterCreator::PreloadCharacterAssets(
+    EYCRCharacterClasses CharacterClass,
+    FStreamableDelegate OnLoaded)
+{
+    TSharedPtr<FStreamableHandle> Existing = PreloadHandles.FindRef(CharacterClass);
+    if (Existing.IsValid() && Existing->HasLoadCompleted())
+    {
+        OnLoaded.ExecuteIfBound();
+        return Existing;
+    }
+
+    TArray<FSoftObjectPath> AssetPaths;
+    GetCharacterAssetPaths(GetCreationData(CharacterClass), AssetPaths);
+
+    if (AssetPaths.IsEmpty())
+    {
+        OnLoaded.ExecuteIfBound();
+        return nullptr;
+    }
+
+    // Callers are queued on the class and run when the load that owns the handle completes
+    if (OnLoaded.IsBound())
+    {
+        PendingPreloadCallbacks.FindOrAdd(CharacterClass).Add(MoveTemp(OnLoaded));
+    }
+
+    // Already streaming - wait for the running load instead of requesting the same paths again
+    if (Existing.IsValid() && Existing->IsLoadingInProgress())
+    {
+        return Existing;
+    }
+
+    const double LoadStart = FPlatformTime::Seconds();
+    FStreamableDelegate OnComplete = FStreamableDelegate::CreateLambda([CharacterClass, LoadStart]()
+    {
+        UE_LOG(LogTemp, Log, TEXT("YCRCharacterCreator: Assets for %s resident after %.1f ms"),
+            *UEnum::GetValueAsString(CharacterClass), (FPlatformTime::Seconds() - LoadStart) * 1000.0);
+
+        TArray<FStreamableDelegate> Callbacks;
+        PendingPreloadCallbacks.RemoveAndCopyValue(CharacterClass, Callbacks);
+        for (const FStreamableDelegate& Callback : Callbacks)
+        {
+            Callback.ExecuteIfBound();
+        }
+    });
+
+    TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+        AssetPaths, MoveTemp(OnComplete), FStreamableManager::AsyncLoadHighPriority);
+    PreloadHandles.Add(CharacterClass, Handle);
+    return Handle;
+}
+
+void UYCRCharacterCreator::PrewarmCharacterClass(EYCRCharacterClasses CharacterClass)
+{
+    PreloadCharacterAssets(CharacterClass);
+}
+
+bool UYCRCharacterCreator::AreCharacterAssetsLoaded(EYCRCharacterClasses CharacterClass)
+{
+    const FYCRCharacterClassTable& Table = GetClassTable();
+    if (!Table.HasCreationData(CharacterClass))
+    {
+        return false;
+    }
 
-    if (FoundData)
+    const FYCRCharacterCreationData& CreationData = Table.GetCreationData(CharacterClass);
+    return (CreationData.CharacterMesh.IsNull() || CreationData.CharacterMesh.IsValid()) &&
+        (CreationData.AnimationBlueprint.IsNull() || CreationData.AnimationBlueprint.IsValid());
+}
+
+void UYCRCharacterCreator::ReleaseCharacterAssets(EYCRCharacterClasses CharacterClass)
+{
+    TSharedPtr<FStreamableHandle> Handle;
+    if (PreloadHandles.RemoveAndCopyValue(CharacterClass, Handle) && Handle.IsValid())
     {
-        OutData = *FoundData;
-        // Cache the data
-        CachedCreationData.Add(CharacterClass, OutData);
-        return true;
+        Handle->ReleaseHandle();
     }
 
-    return false;
+    // A handle released mid-load never completes, so its waiters would only fire on an unrelated later preload
+    PendingPreloadCallbacks.Remove(CharacterClass);
 }
 
 void UYCRCharacterCreator::ApplyCharacterVisuals(
     ACharacterPlayer* Character,
-    const FYCRCharacterCreationData& CreationData)
+    EYCRCharacterClasses CharacterClass)
 {
-    if (!Character)
+    if (!Character || !GetClassTable().HasCreationData(CharacterClass))
+    {
+        return;
+    }
+
+    const FYCRCharacterCreationData& CreationData = GetCreationData(CharacterClass);
+
+    // Not resident yet (class was never prewarmed) - stream in and apply on arrival instead of blocking
+    if ((!CreationData.CharacterMesh.IsNull() && !CreationData.CharacterMesh.IsValid()) ||
+        (!CreationData.AnimationBlueprint.IsNull() && !CreationData.AnimationBlueprint.IsValid()))
     {
+        UE_LOG(LogTemp, Warning, TEXT("YCRCharacterCreator: Visuals for %s were not prewarmed, applying them once loaded"),
+            *CreationData.ClassName.ToString());
+
+        // Joins a preload of the class that is already streaming; the row is looked up again on arrival
+        PreloadCharacterAssets(CharacterClass, FStreamableDelegate::CreateLambda(
+            [WeakCharacter = TWeakObjectPtr<ACharacterPlayer>(Character), CharacterClass]()
+            {
+                if (ACharacterPlayer* LoadedCharacter = WeakCharacter.Get())
+                {
+                    ApplyResidentVisuals(LoadedCharacter, GetCreationData(CharacterClass));
+                }
+            }));
         return;
     }
 
+    ApplyResidentVisuals(Character, CreationData);
+}
+
+void UYCRCharacterCreator::ApplyResidentVisuals(
+    ACharacterPlayer* Character,
+    const FYCRCharacterCreationData& CreationData)
+{
     // Apply skeletal mesh if specified
-    if (CreationData.CharacterMesh.IsValid())
+    if (USkeletalMesh* Mesh = CreationData.CharacterMesh.Get())
     {
-        if (USkeletalMesh* Mesh = CreationData.CharacterMesh.LoadSynchronous())
-        {
-            Character->GetMesh()->SetSkeletalMesh(Mesh);
-        }
+        Character->GetMesh()->SetSkeletalMesh(Mesh);
     }
 
     // Apply animation blueprint if specified
-    if (CreationData.AnimationBlueprint.IsValid())
+    if (UClass* AnimClass = CreationData.AnimationBlueprint.Get())
     {
-        if (UClass* AnimClass = CreationData.AnimationBlueprint.LoadSynchronous())
-        {
-            Character->GetMesh()->SetAnimInstanceClass(AnimClass);
-        }
+        Character->GetMesh()->SetAnimInstanceClass(AnimClass);
     }
 }
 
@@ -0,0 +1,53 @@
+﻿// Copyright YCR. All Rights Reserved.
+
+#include "Core/YCRCreateCharacterAsyncAction.h"
+#include "Core/YCRCharacterCreator.h"
+#include "Character/CharacterPlayer.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+UYCRCreateCharacterAsyncAction* UYCRCreateCharacterAsyncAction::CreatePlayerCharacterAsync(
+    UObject* WorldContextObject,
+    EYCRCharacterClasses CharacterClass,
+    const FVector& SpawnLocation,
+    const FRotator& SpawnRotation)
+{
+    UYCRCreateCharacterAsyncAction* Action = NewObject<UYCRCreateCharacterAsyncAction>();
+    Action->WorldContext = WorldContextObject;
+    Action->CharacterClass = CharacterClass;
+    Action->SpawnLocation = SpawnLocation;
+    Action->SpawnRotation = SpawnRotation;
+
+    if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+    {
+        Action->RegisterWithGameInstance(World);
+    }
+    return Action;
+}
+
+void UYCRCreateCharacterAsyncAction::Activate()
+{
+    // Completes in the same frame when the menu already prewarmed the class
+    UYCRCharacterCreator::PreloadCharacterAssets(CharacterClass,
+        FStreamableDelegate::CreateUObject(this, &UYCRCreateCharacterAsyncAction::OnAssetsLoaded));
+}
+
+void UYCRCreateCharacterAsyncAction::OnAssetsLoaded()
+{
+    ACharacterPlayer* Character = nullptr;
+    if (UObject* Context = WorldContext.Get())
+    {
+        Character = UYCRCharacterCreator::CreatePlayerCharacter(Context, CharacterClass, SpawnLocation, SpawnRotation);
+    }
+
+    if (Character)
+    {
+        OnCreated.Broadcast(Character);
+    }
+    else
+    {
+        OnFailed.Broadcast(nullptr);
+    }
+
+    SetReadyToDestroy();
+}
@@ -0,0 +1,38 @@
+﻿#include "Core/YCRDeveloperSettings.h"
+#include "Engine/DataTable.h"
+#include "Character/CharacterPlayer.h"
+
+UYCRDeveloperSettings::UYCRDeveloperSettings()
+{
+    // Defaults match the assets the character creator used to hard-load, DefaultGame.ini may override them
+    CharacterCreationDataTable = TSoftObjectPtr<UDataTable>(FSoftObjectPath(TEXT("/Game/YCR/Data/DT_CharacterCreationData.DT_CharacterCreationData")));
+    CharacterClassDataTable = TSoftObjectPtr<UDataTable>(FSoftObjectPath(TEXT("/Game/YCR/Data/DT_CharacterClassData.DT_CharacterClassData")));
+    PlayerCharacterClass = TSoftClassPtr<ACharacterPlayer>(FSoftObjectPath(TEXT("/Game/YCR/Blueprints/Characters/BP_CharacterPlayer.BP_CharacterPlayer_C")));
+
+    // Formerly AOutGameMode::MapNames
+    MapRegions = { TEXT("VerdantPlains"), TEXT("ScorchingSands"), TEXT("EnchantedForest"), TEXT("CursedCaverns") };
+    MapDirectory.Path = TEXT("/Game/YCR/Maps");
+}
+
+FName UYCRDeveloperSettings::GetMapRegion(int32 MapLevel) const
+{
+    const int32 MapIndex = (MapLevel - 1) / LevelsPerMap;
+    return MapLevel > 0 && MapRegions.IsValidIndex(MapIndex) ? MapRegions[MapIndex] : NAME_None;
+}
+
+FName UYCRDeveloperSettings::GetLevelMapName(int32 MapLevel) const
+{
+    const FName Region = GetMapRegion(MapLevel);
+    if (Region.IsNone())
+    {
+        return NAME_None;
+    }
+
+    const int32 SubLevel = ((MapLevel - 1) % LevelsPerMap) + 1;
+    return FName(*FString::Printf(TEXT("%s_L%d"), *Region.ToString(), SubLevel));
+}
+
+FString UYCRDeveloperSettings::GetMapPackageName(FName MapName) const
+{
+    return MapDirectory.Path.IsEmpty() ? MapName.ToString() : MapDirectory.Path / MapName.ToString();
+}
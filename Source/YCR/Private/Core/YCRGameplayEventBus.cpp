@@ -0,0 +1,122 @@
+﻿#include "Core/YCRGameplayEventBus.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+void UYCRGameplayEventBus::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    CreateChannel<FYCRRunTimeEvent>();
+    CreateChannel<FYCRCurrencyEvent>();
+    CreateChannel<FYCRExpGemDroppedEvent>();
+    CreateChannel<FYCRCoinDroppedEvent>();
+    CreateChannel<FYCRAchievementUnlockedEvent>();
+
+    BindBlueprintAdapter();
+}
+
+void UYCRGameplayEventBus::Deinitialize()
+{
+    // Deliver what is left so late listeners (save, stats) still see it
+    Flush();
+
+    for (TUniquePtr<FChannelBase>& Channel : Channels)
+    {
+        Channel.Reset();
+    }
+
+    Super::Deinitialize();
+}
+
+UYCRGameplayEventBus* UYCRGameplayEventBus::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GameInstance = World ? World->GetGameInstance() : Cast<UGameInstance>(WorldContextObject);
+    return GameInstance ? GameInstance->GetSubsystem<UYCRGameplayEventBus>() : nullptr;
+}
+
+void UYCRGameplayEventBus::Flush()
+{
+    for (TUniquePtr<FChannelBase>& Channel : Channels)
+    {
+        if (Channel)
+        {
+            Channel->Dispatch();
+        }
+    }
+}
+
+void UYCRGameplayEventBus::BindBlueprintAdapter()
+{
+    // Each adapter reduces the frame's batch to one broadcast and skips the work when nothing is bound
+
+    Subscribe<FYCRRunTimeEvent>(FListener<FYCRRunTimeEvent>::CreateWeakLambda(this, [this](TConstArrayView<FYCRRunTimeEvent> Events)
+    {
+        if (OnRunTimeUpdated.IsBound())
+        {
+            OnRunTimeUpdated.Broadcast(Events.Last().RunTime);
+        }
+    }));
+
+    Subscribe<FYCRCurrencyEvent>(FListener<FYCRCurrencyEvent>::CreateWeakLambda(this, [this](TConstArrayView<FYCRCurrencyEvent> Events)
+    {
+        if (!OnCurrencyChanged.IsBound())
+        {
+            return;
+        }
+
+        // Last amount per currency, in currency order
+        TOptional<int32> Latest[2];
+        for (const FYCRCurrencyEvent& Event : Events)
+        {
+            Latest[static_cast<int32>(Event.Currency)] = Event.NewAmount;
+        }
+        for (int32 i = 0; i < UE_ARRAY_COUNT(Latest); i++)
+        {
+            if (Latest[i].IsSet())
+            {
+                OnCurrencyChanged.Broadcast(static_cast<EYCRCurrency>(i), Latest[i].GetValue());
+            }
+        }
+    }));
+
+    Subscribe<FYCRExpGemDroppedEvent>(FListener<FYCRExpGemDroppedEvent>::CreateWeakLambda(this, [this](TConstArrayView<FYCRExpGemDroppedEvent> Events)
+    {
+        if (OnExpGemsDropped.IsBound())
+        {
+            int32 TotalExp = 0;
+            for (const FYCRExpGemDroppedEvent& Event : Events)
+            {
+                TotalExp += Event.ExpValue;
+            }
+            OnExpGemsDropped.Broadcast(Events.Num(), TotalExp);
+        }
+    }));
+
+    Subscribe<FYCRCoinDroppedEvent>(FListener<FYCRCoinDroppedEvent>::CreateWeakLambda(this, [this](TConstArrayView<FYCRCoinDroppedEvent> Events)
+    {
+        if (OnCoinsDropped.IsBound())
+        {
+            int32 TotalCoins = 0;
+            for (const FYCRCoinDroppedEvent& Event : Events)
+            {
+                TotalCoins += Event.CoinValue;
+            }
+            OnCoinsDropped.Broadcast(Events.Num(), TotalCoins);
+        }
+    }));
+
+    Subscribe<FYCRAchievementUnlockedEvent>(FListener<FYCRAchievementUnlockedEvent>::CreateWeakLambda(this, [this](TConstArrayView<FYCRAchievementUnlockedEvent> Events)
+    {
+        if (OnAchievementsUnlocked.IsBound())
+        {
+            TArray<FName> AchievementIDs;
+            AchievementIDs.Reserve(Events.Num());
+            for (const FYCRAchievementUnlockedEvent& Event : Events)
+            {
+                AchievementIDs.Add(Event.AchievementID);
+            }
+            OnAchievementsUnlocked.Broadcast(AchievementIDs);
+        }
+    }));
+}
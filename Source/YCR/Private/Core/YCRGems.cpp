@@ -1,6 +1,9 @@
 ﻿#include "Core/YCRGems.h"
+#include "Core/GameInstanceYCR.h"
+#include "Core/YCRActorPoolSubsystem.h"
 #include "Enums/EYCRMonsterTypes.h"
 #include "Enums/EYCRGemColor.h"
+#include "Data/YCRPrimaryAssetTypes.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -13,6 +16,11 @@ UYCRGems::UYCRGems()
     MeshScale = FVector(0.5f, 0.5f, 0.5f); // Gems are usually small
 }
 
+FPrimaryAssetId UYCRGems::GetPrimaryAssetId() const
+{
+    return FPrimaryAssetId(FYCRPrimaryAssetTypes::Gems, GetFName());
+}
+
 int32 UYCRGems::GetExperienceForMonsterType(EYCRMonsterType MonsterType)
 {
     // Experience values based on monster difficulty
@@ -47,17 +55,14 @@ AYCRGemPickup* UYCRGemSpawner::SpawnGem(
     int32 ExperienceValue)
 {
     UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
-    if (!World || !GemClass)
+    UYCRActorPoolSubsystem* Pool = World ? World->GetSubsystem<UYCRActorPoolSubsystem>() : nullptr;
+    if (!Pool || !GemClass)
     {
         return nullptr;
     }
 
-    // Spawn parameters
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-    // Spawn the gem
-    AYCRGemPickup* SpawnedGem = World->SpawnActor<AYCRGemPickup>(GemClass, Location, FRotator::ZeroRotator, SpawnParams);
+    // Reuse a collected gem if one is pooled
+    AYCRGemPickup* SpawnedGem = Pool->AcquireActor<AYCRGemPickup>(GemClass, FTransform(Location));
     
     if (SpawnedGem)
     {
@@ -104,15 +109,81 @@ void UYCRGemSpawner::SpawnGemsForMonster(
     // Get experience value for this monster type
     int32 ExpValue = UYCRGems::GetExperienceForMonsterType(MonsterType);
 
-    // Spawn multiple gems with slight position offset
+    // Scatter all gems in one pass, then spawn them as one batch
+    TArray<FVector> SpawnLocations;
+    const FRandomStream& ScatterStream = UGameInstanceYCR::GetRandomStream(WorldContextObject, EYCRRandomStream::GemScatter);
+    ComputeScatterLocations(Location, GemCount, 50.0f, ScatterStream, SpawnLocations);
+
+    SpawnGemsBatch(WorldContextObject, GemClass, SpawnLocations, GemColor, { ExpValue });
+}
+
+int32 UYCRGemSpawner::SpawnGemsBatch(
+    UObject* WorldContextObject,
+    TSubclassOf<AYCRGemPickup> GemClass,
+    const TArray<FVector>& Locations,
+    EYCRGemColor GemColor,
+    const TArray<int32>& ExperienceValues)
+{
+    if (!GemClass || Locations.IsEmpty() || ExperienceValues.IsEmpty())
+    {
+        return 0;
+    }
+
+    // Resolve world and pool once for the whole batch
+    UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull);
+    UYCRActorPoolSubsystem* Pool = World ? World->GetSubsystem<UYCRActorPoolSubsystem>() : nullptr;
+    if (!Pool)
+    {
+        return 0;
+    }
+
+    const bool bSharedValue = ExperienceValues.Num() == 1;
+    int32 SpawnedCount = 0;
+
+    for (int32 i = 0; i < Locations.Num(); i++)
+    {
+        AYCRGemPickup* Gem = Pool->AcquireActor<AYCRGemPickup>(GemClass, FTransform(Locations[i]));
+        if (!Gem)
+        {
+            continue;
+        }
+
+        const int32 ExpValue = bSharedValue ? ExperienceValues[0] : ExperienceValues[FMath::Min(i, ExperienceValues.Num() - 1)];
+        Gem->SetGemProperties(GemColor, ExpValue);
+        SpawnedCount++;
+    }
+
+    return SpawnedCount;
+}
+
+void UYCRGemSpawner::ComputeScatterLocations(
+    const FVector& Center,
+    int32 GemCount,
+    float Radius,
+    const FRandomStream& Stream,
+    TArray<FVector>& OutLocations)
+{
+    OutLocations.Reset(GemCount);
+    if (GemCount <= 0)
+    {
+        return;
+    }
+
+    // Keep density constant: the disc grows with the square root of the gem count
+    const float SpreadRadius = Radius * FMath::Max(1.0f, FMath::Sqrt(GemCount / 4.0f));
+    const float GoldenAngle = PI * (3.0f - FMath::Sqrt(5.0f));
+    const float AngleOffset = Stream.FRandRange(0.0f, 2.0f * PI);
+    const float Jitter = SpreadRadius / FMath::Max(1.0f, FMath::Sqrt(static_cast<float>(GemCount))) * 0.25f;
+
     for (int32 i = 0; i < GemCount; i++)
     {
-        // Add random offset to prevent gems spawning on top of each other
-        FVector SpawnLocation = Location;
-        SpawnLocation.X += FMath::RandRange(-50.0f, 50.0f);
-        SpawnLocation.Y += FMath::RandRange(-50.0f, 50.0f);
-        SpawnLocation.Z += 10.0f; // Slight elevation
+        const float Distance = SpreadRadius * FMath::Sqrt((i + 0.5f) / GemCount);
+        float Sin, Cos;
+        FMath::SinCos(&Sin, &Cos, AngleOffset + i * GoldenAngle);
 
-        SpawnGem(WorldContextObject, GemClass, SpawnLocation, GemColor, ExpValue);
+        FVector& SpawnLocation = OutLocations.Emplace_GetRef(Center);
+        SpawnLocation.X += Cos * Distance + Stream.FRandRange(-Jitter, Jitter);
+        SpawnLocation.Y += Sin * Distance + Stream.FRandRange(-Jitter, Jitter);
+        SpawnLocation.Z += 10.0f; // Slight elevation
     }
 }
\ No newline at end of file
@@ -0,0 +1,109 @@
+﻿#include "Core/YCRHordeScalability.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ConfigUtilities.h"
+#include "Misc/CoreGlobals.h"
+
+namespace YCRHordeScalability
+{
+    static void OnQualityLevelChanged(IConsoleVariable* Variable);
+
+    static TAutoConsoleVariable<int32> CVarHordeQuality(
+        TEXT("sg.HordeQuality"),
+        3,
+        TEXT("Horde quality level, applies [HordeQuality@N] from the scalability ini.\n")
+        TEXT(" 0: Low, 1: Medium, 2: High, 3: Epic"),
+        FConsoleVariableDelegate::CreateStatic(&OnQualityLevelChanged),
+        ECVF_ScalabilityGroup | ECVF_Preview);
+
+    static TAutoConsoleVariable<int32> CVarMaxLiveEnemies(
+        TEXT("horde.MaxLiveEnemies"),
+        1000,
+        TEXT("Hard ceiling for live enemies, the enemy budget stays below it."),
+        ECVF_Scalability);
+
+    static TAutoConsoleVariable<float> CVarAILodDistanceScale(
+        TEXT("horde.AILodDistanceScale"),
+        1.0f,
+        TEXT("Multiplier on the enemy AI LOD distance (enemies beyond it think at a reduced rate)."),
+        ECVF_Scalability);
+
+    static TAutoConsoleVariable<int32> CVarGemConsolidationBudget(
+        TEXT("horde.GemConsolidationBudget"),
+        1000,
+        TEXT("Live experience gems before new drops are merged into existing ones."),
+        ECVF_Scalability);
+
+    static TAutoConsoleVariable<int32> CVarMaxProjectiles(
+        TEXT("horde.MaxProjectiles"),
+        1000,
+        TEXT("Live projectiles before new ones are refused."),
+        ECVF_Scalability);
+
+    static TAutoConsoleVariable<float> CVarStatusEffectTickRate(
+        TEXT("horde.StatusEffectTickRate"),
+        0.0f,
+        TEXT("Status effect updates per second, 0 = every frame."),
+        ECVF_Scalability);
+
+    static TAutoConsoleVariable<float> CVarCorpseLifetime(
+        TEXT("horde.CorpseLifetime"),
+        2.0f,
+        TEXT("Seconds a dead enemy stays before it is removed."),
+        ECVF_Scalability);
+
+    static void OnQualityLevelChanged(IConsoleVariable* Variable)
+    {
+        FYCRHordeScalability::ApplyQualityLevel();
+    }
+}
+
+int32 FYCRHordeScalability::GetQualityLevel()
+{
+    return FMath::Clamp(YCRHordeScalability::CVarHordeQuality.GetValueOnGameThread(), 0, NumQualityLevels - 1);
+}
+
+void FYCRHordeScalability::SetQualityLevel(int32 Level)
+{
+    YCRHordeScalability::CVarHordeQuality->Set(FMath::Clamp(Level, 0, NumQualityLevels - 1), ECVF_SetByGameSetting);
+}
+
+void FYCRHordeScalability::ApplyQualityLevel()
+{
+    // Scalability priority, so device profile and console overrides of single cvars survive
+    UE::ConfigUtilities::ApplyCVarSettingsGroupFromIni(TEXT("HordeQuality"), GetQualityLevel(), *GScalabilityIni, ECVF_SetByScalability);
+
+    UE_LOG(LogTemp, Log, TEXT("Horde quality %d: %d enemies, %d gems, %d projectiles"),
+        GetQualityLevel(), GetMaxLiveEnemies(), GetGemConsolidationBudget(), GetMaxProjectiles());
+}
+
+int32 FYCRHordeScalability::GetMaxLiveEnemies()
+{
+    return FMath::Max(1, YCRHordeScalability::CVarMaxLiveEnemies.GetValueOnGameThread());
+}
+
+float FYCRHordeScalability::GetAILodDistanceScale()
+{
+    return FMath::Max(0.0f, YCRHordeScalability::CVarAILodDistanceScale.GetValueOnGameThread());
+}
+
+int32 FYCRHordeScalability::GetGemConsolidationBudget()
+{
+    return FMath::Max(1, YCRHordeScalability::CVarGemConsolidationBudget.GetValueOnGameThread());
+}
+
+int32 FYCRHordeScalability::GetMaxProjectiles()
+{
+    return FMath::Max(1, YCRHordeScalability::CVarMaxProjectiles.GetValueOnGameThread());
+}
+
+float FYCRHordeScalability::GetStatusEffectTickInterval()
+{
+    const float TickRate = YCRHordeScalability::CVarStatusEffectTickRate.GetValueOnGameThread();
+    return TickRate > 0.0f ? 1.0f / TickRate : 0.0f;
+}
+
+float FYCRHordeScalability::GetCorpseLifetime()
+{
+    // A life span of 0 would keep the corpse forever
+    return FMath::Max(0.1f, YCRHordeScalability::CVarCorpseLifetime.GetValueOnGameThread());
+}
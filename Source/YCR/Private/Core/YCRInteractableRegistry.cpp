@@ -0,0 +1,219 @@
+﻿#include "Core/YCRInteractableRegistry.h"
+#include "Interfaces/IInteractableInterface.h"
+#include "GameFramework/Character.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+void UYCRInteractableRegistry::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Placed interactables, then everything spawned from here on
+    for (FActorIterator It(&InWorld); It; ++It)
+    {
+        RegisterInteractable(*It);
+    }
+
+    ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(
+        FOnActorSpawned::FDelegate::CreateUObject(this, &UYCRInteractableRegistry::HandleActorSpawned));
+}
+
+void UYCRInteractableRegistry::Deinitialize()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+    }
+
+    Entries.Empty();
+    EntryIndices.Empty();
+    Cells.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId UYCRInteractableRegistry::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UYCRInteractableRegistry, STATGROUP_Tickables);
+}
+
+// =====================================================
+// Registration
+// =====================================================
+
+void UYCRInteractableRegistry::RegisterInteractable(AActor* Actor)
+{
+    if (!IsValid(Actor) || !Actor->Implements<UIInteractableInterface>() || EntryIndices.Contains(Actor))
+    {
+        return;
+    }
+
+    FEntry Entry;
+    Entry.Actor = Actor;
+    Entry.Location = Actor->GetActorLocation();
+    Entry.Cell = GetCell(Entry.Location);
+
+    const int32 EntryIndex = Entries.Add(Entry);
+    EntryIndices.Add(Actor, EntryIndex);
+    AddToCell(EntryIndex);
+
+    Actor->OnEndPlay.AddUniqueDynamic(this, &UYCRInteractableRegistry::HandleActorEndPlay);
+}
+
+void UYCRInteractableRegistry::UnregisterInteractable(AActor* Actor)
+{
+    int32 EntryIndex = INDEX_NONE;
+    if (!EntryIndices.RemoveAndCopyValue(Actor, EntryIndex))
+    {
+        return;
+    }
+
+    RemoveFromCell(EntryIndex);
+    Entries.RemoveAt(EntryIndex);
+
+    if (Actor && Actor == FocusedInteractable.Get())
+    {
+        FocusedInteractable.Reset();
+        OnFocusChanged.Broadcast(nullptr);
+    }
+
+    if (IsValid(Actor))
+    {
+        Actor->OnEndPlay.RemoveDynamic(this, &UYCRInteractableRegistry::HandleActorEndPlay);
+    }
+}
+
+void UYCRInteractableRegistry::UpdateInteractable(AActor* Actor)
+{
+    const int32* EntryIndex = EntryIndices.Find(Actor);
+    if (!EntryIndex || !IsValid(Actor))
+    {
+        return;
+    }
+
+    FEntry& Entry = Entries[*EntryIndex];
+    Entry.Location = Actor->GetActorLocation();
+
+    const FIntPoint NewCell = GetCell(Entry.Location);
+    if (NewCell != Entry.Cell)
+    {
+        RemoveFromCell(*EntryIndex);
+        Entry.Cell = NewCell;
+        AddToCell(*EntryIndex);
+    }
+}
+
+FIntPoint UYCRInteractableRegistry::GetCell(const FVector& Location)
+{
+    return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void UYCRInteractableRegistry::AddToCell(int32 EntryIndex)
+{
+    Cells.FindOrAdd(Entries[EntryIndex].Cell).Add(EntryIndex);
+}
+
+void UYCRInteractableRegistry::RemoveFromCell(int32 EntryIndex)
+{
+    const FIntPoint Cell = Entries[EntryIndex].Cell;
+    if (TArray<int32, TInlineAllocator<4>>* CellEntries = Cells.Find(Cell))
+    {
+        CellEntries->RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+        if (CellEntries->IsEmpty())
+        {
+            Cells.Remove(Cell);
+        }
+    }
+}
+
+void UYCRInteractableRegistry::HandleActorSpawned(AActor* Actor)
+{
+    RegisterInteractable(Actor);
+}
+
+void UYCRInteractableRegistry::HandleActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+    UnregisterInteractable(Actor);
+}
+
+// =====================================================
+// Queries
+// =====================================================
+
+AActor* UYCRInteractableRegistry::FindClosestInteractable(const FVector& Location, float Radius, ACharacter* Interactor) const
+{
+    const FIntPoint MinCell = GetCell(Location - FVector(Radius, Radius, 0.0f));
+    const FIntPoint MaxCell = GetCell(Location + FVector(Radius, Radius, 0.0f));
+
+    AActor* Closest = nullptr;
+    float BestDistSq = FMath::Square(Radius);
+
+    for (int32 Y = MinCell.Y; Y <= MaxCell.Y; Y++)
+    {
+        for (int32 X = MinCell.X; X <= MaxCell.X; X++)
+        {
+            const TArray<int32, TInlineAllocator<4>>* CellEntries = Cells.Find(FIntPoint(X, Y));
+            if (!CellEntries)
+            {
+                continue;
+            }
+
+            for (const int32 EntryIndex : *CellEntries)
+            {
+                const FEntry& Entry = Entries[EntryIndex];
+                const float DistSq = FVector::DistSquared2D(Location, Entry.Location);
+                if (DistSq > BestDistSq)
+                {
+                    continue;
+                }
+
+                // Blueprint check only for candidates that would win on distance
+                AActor* Actor = Entry.Actor.Get();
+                if (!Actor || Actor->IsHidden() ||
+                    (Interactor && !IIInteractableInterface::Execute_CanInteract(Actor, Interactor)))
+                {
+                    continue;
+                }
+
+                BestDistSq = DistSq;
+                Closest = Actor;
+            }
+        }
+    }
+
+    return Closest;
+}
+
+// =====================================================
+// Focus Tracking
+// =====================================================
+
+void UYCRInteractableRegistry::SetFocusTracker(ACharacter* Interactor, float Radius)
+{
+    FocusTracker = Interactor;
+    FocusRadius = Radius;
+
+    if (!Interactor && FocusedInteractable.IsValid())
+    {
+        FocusedInteractable.Reset();
+        OnFocusChanged.Broadcast(nullptr);
+    }
+}
+
+void UYCRInteractableRegistry::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    ACharacter* Interactor = FocusTracker.Get();
+    if (!Interactor)
+    {
+        return;
+    }
+
+    AActor* NewFocus = FindClosestInteractable(Interactor->GetActorLocation(), FocusRadius, Interactor);
+    if (NewFocus != FocusedInteractable.Get())
+    {
+        FocusedInteractable = NewFocus;
+        OnFocusChanged.Broadcast(NewFocus);
+    }
+}
@@ -0,0 +1,292 @@
+﻿#include "Core/YCRProgressJournal.h"
+#include "Data/YCRSaveGameData.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace YCRJournal
+{
+    // Frame header: payload size + payload CRC
+    constexpr int32 FrameHeaderSize = sizeof(uint32) * 2;
+}
+
+// =====================================================
+// Journal Record
+// =====================================================
+
+FYCRJournalRecord FYCRJournalRecord::MakeAddEssence(int32 Amount)
+{
+    FYCRJournalRecord Record;
+    Record.Op = EYCRJournalOp::AddEssence;
+    Record.Value = Amount;
+    return Record;
+}
+
+FYCRJournalRecord FYCRJournalRecord::MakeUnlockMap(int32 MapLevel)
+{
+    FYCRJournalRecord Record;
+    Record.Op = EYCRJournalOp::UnlockMap;
+    Record.Value = MapLevel;
+    return Record;
+}
+
+FYCRJournalRecord FYCRJournalRecord::MakeUnlockCharacter(const FName& CharacterClass, int32 AdvancementLevel)
+{
+    FYCRJournalRecord Record;
+    Record.Op = EYCRJournalOp::UnlockCharacter;
+    Record.Name = CharacterClass;
+    Record.Value = AdvancementLevel;
+    return Record;
+}
+
+FYCRJournalRecord FYCRJournalRecord::MakeCollectCard(const FName& CardName)
+{
+    FYCRJournalRecord Record;
+    Record.Op = EYCRJournalOp::CollectCard;
+    Record.Name = CardName;
+    return Record;
+}
+
+FYCRJournalRecord FYCRJournalRecord::MakeUnlockAchievement(const FString& AchievementID)
+{
+    FYCRJournalRecord Record;
+    Record.Op = EYCRJournalOp::UnlockAchievement;
+    Record.Text = AchievementID;
+    return Record;
+}
+
+FYCRJournalRecord FYCRJournalRecord::MakeRunResult(bool bInVictory, int32 InLevel, int32 InMonstersKilled,
+    int32 InElitesKilled, int32 InBossesKilled, int32 InGoldCollected)
+{
+    FYCRJournalRecord Record;
+    Record.Op = EYCRJournalOp::RunResult;
+    Record.bVictory = bInVictory;
+    Record.Level = InLevel;
+    Record.MonstersKilled = InMonstersKilled;
+    Record.ElitesKilled = InElitesKilled;
+    Record.BossesKilled = InBossesKilled;
+    Record.GoldCollected = InGoldCollected;
+    return Record;
+}
+
+void FYCRJournalRecord::Serialize(FArchive& Ar)
+{
+    uint8 OpByte = static_cast<uint8>(Op);
+    Ar << OpByte;
+    if (OpByte >= static_cast<uint8>(EYCRJournalOp::MAX))
+    {
+        Ar.SetError();
+        return;
+    }
+    Op = static_cast<EYCRJournalOp>(OpByte);
+
+    Ar << Sequence;
+
+    switch (Op)
+    {
+    case EYCRJournalOp::AddEssence:
+    case EYCRJournalOp::UnlockMap:
+        Ar << Value;
+        break;
+
+    case EYCRJournalOp::UnlockCharacter:
+        Ar << Name;
+        Ar << Value;
+        break;
+
+    case EYCRJournalOp::CollectCard:
+        Ar << Name;
+        break;
+
+    case EYCRJournalOp::UnlockAchievement:
+        Ar << Text;
+        break;
+
+    case EYCRJournalOp::RunResult:
+        Ar << bVictory;
+        Ar << Level;
+        Ar << MonstersKilled;
+        Ar << ElitesKilled;
+        Ar << BossesKilled;
+        Ar << GoldCollected;
+        break;
+
+    default:
+        break;
+    }
+}
+
+void FYCRJournalRecord::ApplyTo(FPlayerProgressData& Progress) const
+{
+    switch (Op)
+    {
+    case EYCRJournalOp::AddEssence:
+        Progress.TotalEssence += Value;
+        break;
+
+    case EYCRJournalOp::UnlockMap:
+        Progress.HighestMapUnlocked = FMath::Max(Progress.HighestMapUnlocked, Value);
+        break;
+
+    case EYCRJournalOp::UnlockCharacter:
+    {
+        int32& AdvancementLevel = Progress.UnlockedCharacters.FindOrAdd(Name, 0);
+        AdvancementLevel = FMath::Max(AdvancementLevel, Value);
+        break;
+    }
+
+    case EYCRJournalOp::CollectCard:
+        Progress.CollectedCards.FindOrAdd(Name, 0)++;
+        break;
+
+    case EYCRJournalOp::UnlockAchievement:
+        Progress.UnlockedAchievements.Add(Text);
+        break;
+
+    case EYCRJournalOp::RunResult:
+        if (bVictory)
+        {
+            Progress.TotalRunsWon++;
+            Progress.HighestLevelReached = FMath::Max(Progress.HighestLevelReached, Level);
+        }
+        Progress.TotalRunsPlayed++;
+        Progress.TotalMonstersKilled += MonstersKilled;
+        Progress.TotalElitesKilled += ElitesKilled;
+        Progress.TotalBossesKilled += BossesKilled;
+        Progress.TotalGoldCollected += GoldCollected;
+        break;
+
+    default:
+        break;
+    }
+}
+
+// =====================================================
+// Progress Journal
+// =====================================================
+
+void FYCRProgressJournal::Initialize(const FString& InFilePath)
+{
+    FilePath = InFilePath;
+    PendingBytes.Reset();
+    JournalBytes = 0;
+}
+
+void FYCRProgressJournal::Append(FYCRJournalRecord& Record)
+{
+    Record.Sequence = ++LastSequence;
+
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    TArray<uint8> Payload;
+    FMemoryWriter PayloadWriter(Payload);
+    Record.Serialize(PayloadWriter);
+
+    uint32 PayloadSize = Payload.Num();
+    uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+
+    FMemoryWriter FrameWriter(PendingBytes, false, true);
+    FrameWriter << PayloadSize;
+    FrameWriter << PayloadCrc;
+    FrameWriter.Serialize(Payload.GetData(), Payload.Num());
+}
+
+TArray<uint8> FYCRProgressJournal::TakePending()
+{
+    JournalBytes += PendingBytes.Num();
+    return MoveTemp(PendingBytes);
+}
+
+void FYCRProgressJournal::RestorePending(TArray<uint8>&& Bytes)
+{
+    JournalBytes = FMath::Max<int64>(0, JournalBytes - Bytes.Num());
+    Bytes.Append(PendingBytes);
+    PendingBytes = MoveTemp(Bytes);
+}
+
+int32 FYCRProgressJournal::Replay(int64 SnapshotSequence, FPlayerProgressData& Progress)
+{
+    LastSequence = SnapshotSequence;
+    PendingBytes.Reset();
+    JournalBytes = 0;
+
+    TArray<uint8> FileBytes;
+    if (!IsEnabled() || !FFileHelper::LoadFileToArray(FileBytes, *FilePath, FILEREAD_Silent))
+    {
+        return 0;
+    }
+    JournalBytes = FileBytes.Num();
+
+    int32 AppliedCount = 0;
+    int64 Offset = 0;
+    while (Offset + YCRJournal::FrameHeaderSize <= FileBytes.Num())
+    {
+        uint32 PayloadSize = 0;
+        uint32 PayloadCrc = 0;
+        FMemoryReaderView HeaderReader(MakeArrayView(FileBytes.GetData() + Offset, YCRJournal::FrameHeaderSize));
+        HeaderReader << PayloadSize;
+        HeaderReader << PayloadCrc;
+
+        const int64 PayloadOffset = Offset + YCRJournal::FrameHeaderSize;
+        if (PayloadOffset + PayloadSize > FileBytes.Num() ||
+            FCrc::MemCrc32(FileBytes.GetData() + PayloadOffset, PayloadSize) != PayloadCrc)
+        {
+            break;
+        }
+
+        FYCRJournalRecord Record;
+        FMemoryReaderView PayloadReader(MakeArrayView(FileBytes.GetData() + PayloadOffset, PayloadSize));
+        Record.Serialize(PayloadReader);
+        if (PayloadReader.IsError())
+        {
+            break;
+        }
+
+        // Older records were already folded into the snapshot (crash between snapshot and journal delete)
+        if (Record.Sequence > LastSequence)
+        {
+            Record.ApplyTo(Progress);
+            LastSequence = Record.Sequence;
+            AppliedCount++;
+        }
+
+        Offset = PayloadOffset + PayloadSize;
+    }
+
+    if (Offset < FileBytes.Num())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Progress journal %s: ignoring %lld bytes of incomplete or corrupt records"),
+            *FilePath, FileBytes.Num() - Offset);
+    }
+
+    return AppliedCount;
+}
+
+void FYCRProgressJournal::OnCompacted()
+{
+    PendingBytes.Reset();
+    JournalBytes = 0;
+}
+
+bool FYCRProgressJournal::AppendToFile(const FString& InFilePath, const TArray<uint8>& Bytes)
+{
+    TUniquePtr<FArchive> File(IFileManager::Get().CreateFileWriter(*InFilePath, FILEWRITE_Append | FILEWRITE_AllowRead));
+    if (!File)
+    {
+        return false;
+    }
+
+    File->Serialize(const_cast<uint8*>(Bytes.GetData()), Bytes.Num());
+    return File->Close();
+}
+
+bool FYCRProgressJournal::DeleteJournalFile(const FString& InFilePath)
+{
+    IFileManager& FileManager = IFileManager::Get();
+    return !FileManager.FileExists(*InFilePath) || FileManager.Delete(*InFilePath, false, true, true);
+}
@@ -0,0 +1,183 @@
+﻿#include "Core/YCRRunCheckpoint.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace YCRRunCheckpoint
+{
+    // "YCRC"
+    constexpr uint32 Magic = 0x43524359;
+    constexpr uint16 Version = 2;
+
+    // Magic, version, reserved, raw size, raw CRC
+    constexpr int32 HeaderSize = sizeof(uint32) + sizeof(uint16) * 2 + sizeof(uint32) * 2;
+
+    // Fast to decompress, which is what restore time depends on
+    const FName CompressionFormat = NAME_Oodle;
+}
+
+uint16 FYCRRunCheckpoint::AddClass(const UClass* Class)
+{
+    const FSoftClassPath ClassPath(Class);
+    const int32 Existing = ClassTable.IndexOfByKey(ClassPath);
+    return static_cast<uint16>(Existing != INDEX_NONE ? Existing : ClassTable.Add(ClassPath));
+}
+
+void FYCRRunCheckpoint::QuantizePosition(const FVector& Location, int16 OutPosition[3]) const
+{
+    const FVector Offset = (Location - Origin) / PositionQuantization;
+    for (int32 Axis = 0; Axis < 3; Axis++)
+    {
+        OutPosition[Axis] = static_cast<int16>(FMath::Clamp(FMath::RoundToInt(Offset[Axis]), MIN_int16, MAX_int16));
+    }
+}
+
+FVector FYCRRunCheckpoint::DequantizePosition(const int16 Position[3]) const
+{
+    return Origin + FVector(Position[0], Position[1], Position[2]) * PositionQuantization;
+}
+
+void FYCRRunCheckpoint::Serialize(FArchive& Ar)
+{
+    // Run data
+    Ar << RunData.SelectedCharacter;
+    Ar << RunData.CurrentMapLevel;
+    Ar << RunData.CurrentLevel;
+    Ar << RunData.RunTime;
+    Ar << RunData.MonstersKilled;
+    Ar << RunData.ElitesKilled;
+    Ar << RunData.BossesKilled;
+    Ar << RunData.GoldCollected;
+    Ar << RunData.ExperienceCollected;
+    Ar << RunData.RunSeed;
+    Ar << RandomStreamSeeds;
+
+    Ar << RunTime;
+    Ar << bBossSpawned;
+
+    // Player
+    Ar << Origin;
+    Ar << PlayerYaw;
+    Ar << PlayerLevel;
+    Ar << CurrentExperience;
+    Ar << ExperienceToNextLevel;
+    Ar << CurrentGold;
+    Ar << AttributeBaseValues;
+
+    int32 AbilityCount = Abilities.Num();
+    Ar << AbilityCount;
+    if (Ar.IsLoading())
+    {
+        Abilities.SetNumUninitialized(FMath::Clamp(AbilityCount, 0, 1024));
+    }
+    for (FYCRCheckpointAbility& Ability : Abilities)
+    {
+        Ar << Ability.ClassIndex;
+        Ar << Ability.Level;
+    }
+
+    // World - fixed size records, written field by field to stay endian safe
+    Ar << ClassTable;
+
+    int32 EnemyCount = Enemies.Num();
+    Ar << EnemyCount;
+    if (Ar.IsLoading())
+    {
+        Enemies.SetNumUninitialized(FMath::Clamp(EnemyCount, 0, 65536));
+    }
+    for (FYCRCheckpointEnemy& Enemy : Enemies)
+    {
+        Ar << Enemy.ClassIndex;
+        Ar << Enemy.Position[0] << Enemy.Position[1] << Enemy.Position[2];
+        Ar << Enemy.Yaw;
+        Ar << Enemy.Level;
+        Ar << Enemy.HealthFraction;
+    }
+
+    int32 GemCount = Gems.Num();
+    Ar << GemCount;
+    if (Ar.IsLoading())
+    {
+        Gems.SetNumUninitialized(FMath::Clamp(GemCount, 0, 65536));
+    }
+    for (FYCRCheckpointGem& Gem : Gems)
+    {
+        Ar << Gem.ClassIndex;
+        Ar << Gem.Position[0] << Gem.Position[1] << Gem.Position[2];
+        Ar << Gem.GemColor;
+        Ar << Gem.ExperienceValue;
+    }
+}
+
+void FYCRRunCheckpoint::WriteTo(TArray<uint8>& OutBytes) const
+{
+    // Serialize is symmetric and only reads when saving
+    FMemoryWriter Writer(OutBytes);
+    const_cast<FYCRRunCheckpoint*>(this)->Serialize(Writer);
+}
+
+bool FYCRRunCheckpoint::Encode(const TArray<uint8>& RawBytes, TArray<uint8>& OutBlob)
+{
+    using namespace YCRRunCheckpoint;
+
+    int32 CompressedSize = FCompression::CompressMemoryBound(CompressionFormat, RawBytes.Num());
+    OutBlob.SetNumUninitialized(HeaderSize + CompressedSize);
+
+    if (!FCompression::CompressMemory(CompressionFormat, OutBlob.GetData() + HeaderSize, CompressedSize,
+        RawBytes.GetData(), RawBytes.Num()))
+    {
+        return false;
+    }
+    OutBlob.SetNum(HeaderSize + CompressedSize, EAllowShrinking::No);
+
+    uint32 FileMagic = Magic;
+    uint16 FileVersion = Version;
+    uint16 Reserved = 0;
+    uint32 RawSize = RawBytes.Num();
+    uint32 RawCrc = FCrc::MemCrc32(RawBytes.GetData(), RawBytes.Num());
+
+    TArray<uint8> Header;
+    FMemoryWriter HeaderWriter(Header);
+    HeaderWriter << FileMagic << FileVersion << Reserved << RawSize << RawCrc;
+    FMemory::Memcpy(OutBlob.GetData(), Header.GetData(), HeaderSize);
+    return true;
+}
+
+bool FYCRRunCheckpoint::Decode(TConstArrayView<uint8> Blob, FYCRRunCheckpoint& OutCheckpoint)
+{
+    using namespace YCRRunCheckpoint;
+
+    if (Blob.Num() < HeaderSize)
+    {
+        return false;
+    }
+
+    uint32 FileMagic = 0;
+    uint16 FileVersion = 0;
+    uint16 Reserved = 0;
+    uint32 RawSize = 0;
+    uint32 RawCrc = 0;
+    FMemoryReaderView HeaderReader(Blob.Left(HeaderSize));
+    HeaderReader << FileMagic << FileVersion << Reserved << RawSize << RawCrc;
+
+    // Checkpoints are short lived - an unknown version is simply not resumable
+    if (FileMagic != Magic || FileVersion != Version || RawSize > 64 * 1024 * 1024)
+    {
+        return false;
+    }
+
+    TArray<uint8> RawBytes;
+    RawBytes.SetNumUninitialized(RawSize);
+    if (!FCompression::UncompressMemory(CompressionFormat, RawBytes.GetData(), RawSize,
+        Blob.GetData() + HeaderSize, Blob.Num() - HeaderSize) ||
+        FCrc::MemCrc32(RawBytes.GetData(), RawBytes.Num()) != RawCrc)
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(RawBytes);
+    OutCheckpoint = FYCRRunCheckpoint();
+    OutCheckpoint.Serialize(Reader);
+    return !Reader.IsError();
+}
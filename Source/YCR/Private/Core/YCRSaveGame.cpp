@@ -2,6 +2,26 @@
 
 #include "YCR/Public/Core/YCRSaveGame.h"
 
+namespace YCRSaveGameCompletion
+{
+    // Characters unlocked (20%)
+    constexpr float CharacterWeight = 20.0f;
+    constexpr int32 TotalCharacters = 6; // Base classes
+
+    // Maps completed (40%)
+    constexpr float MapWeight = 40.0f;
+    constexpr int32 TotalMaps = 20; // 4 regions x 5 levels
+    constexpr int32 LevelsPerMap = 5;
+
+    // Achievements (30%)
+    constexpr float AchievementWeight = 30.0f;
+    constexpr int32 TotalAchievements = 100; // Annahme
+
+    // Cards collected (10%)
+    constexpr float CardWeight = 10.0f;
+    constexpr int32 TotalCards = 50; // Annahme
+}
+
 UYCRSaveGame::UYCRSaveGame()
 {
     SaveSlotName = TEXT("YCRSaveSlot1");
@@ -13,121 +33,251 @@ UYCRSaveGame::UYCRSaveGame()
     DefaultCharacter.AdvancementLevel = 1;
     DefaultCharacter.bIsUnlocked = true;
     UnlockedCharacters.Add(DefaultCharacter);
+
+    RebuildIndices();
 }
 
-bool UYCRSaveGame::IsCharacterUnlocked(const FName& CharacterClass) const
+void UYCRSaveGame::Serialize(FArchive& Ar)
 {
-    for (const FCharacterUnlockData& CharData : UnlockedCharacters)
+    Super::Serialize(Ar);
+
+    if (Ar.IsLoading())
     {
-        if (CharData.CharacterClass == CharacterClass && CharData.bIsUnlocked)
-        {
-            return true;
-        }
+        RebuildIndices();
     }
-    return false;
 }
 
-int32 UYCRSaveGame::GetCharacterAdvancementLevel(const FName& CharacterClass) const
+// =====================================================
+// Indices
+// =====================================================
+
+void UYCRSaveGame::RebuildIndices()
 {
-    for (const FCharacterUnlockData& CharData : UnlockedCharacters)
+    const UEnum* ClassEnum = StaticEnum<EYCRCharacterClasses>();
+
+    CharacterSlots.Reset();
+    CharacterSlots.Reserve(UnlockedCharacters.Num());
+    for (int32& Slot : ClassSlots)
+    {
+        Slot = INDEX_NONE;
+    }
+    UnlockedCharacterCount = 0;
+    for (int32 Slot = 0; Slot < UnlockedCharacters.Num(); Slot++)
     {
-        if (CharData.CharacterClass == CharacterClass)
+        const FCharacterUnlockData& CharData = UnlockedCharacters[Slot];
+        CharacterSlots.Add(CharData.CharacterClass, Slot);
+
+        const int32 ClassValue = static_cast<int32>(ClassEnum->GetValueByNameString(CharData.CharacterClass.ToString()));
+        if (ClassSlots.IsValidIndex(ClassValue))
         {
-            return CharData.AdvancementLevel;
+            ClassSlots[ClassValue] = Slot;
+        }
+
+        if (CharData.bIsUnlocked)
+        {
+            UnlockedCharacterCount++;
         }
     }
-    return 0;
-}
 
-int32 UYCRSaveGame::GetCardCount(const FName& CardID) const
-{
-    for (const FCardSaveData& CardData : CollectedCards)
+    CardSlots.Reset();
+    CardSlots.Reserve(CollectedCards.Num());
+    for (int32 Slot = 0; Slot < CollectedCards.Num(); Slot++)
+    {
+        CardSlots.Add(CollectedCards[Slot].CardID, Slot);
+    }
+
+    AchievementSlots.Reset();
+    AchievementSlots.Reserve(CompletedAchievements.Num());
+    for (int32 Slot = 0; Slot < CompletedAchievements.Num(); Slot++)
     {
-        if (CardData.CardID == CardID)
+        AchievementSlots.Add(CompletedAchievements[Slot].AchievementID, Slot);
+    }
+
+    UnlockedAchievementBits.Init(false, static_cast<int32>(EYCRAchievementID::MAX));
+    for (const EYCRAchievementID AchievementID : UnlockedAchievements)
+    {
+        // Saves from a newer build can hold IDs this one does not know
+        if (UnlockedAchievementBits.IsValidIndex(static_cast<int32>(AchievementID)))
         {
-            return CardData.Count;
+            UnlockedAchievementBits[static_cast<int32>(AchievementID)] = true;
         }
     }
-    return 0;
+
+    CompletedMapLevels = 0;
+    for (const auto& MapPair : MapProgress)
+    {
+        CompletedMapLevels += FMath::Min(MapPair.Value.HighestLevelCompleted, YCRSaveGameCompletion::LevelsPerMap);
+    }
+
+    UpdateCompletionPercentage();
+}
+
+void UYCRSaveGame::UpdateCompletionPercentage()
+{
+    using namespace YCRSaveGameCompletion;
+
+    float TotalProgress = 0.0f;
+    TotalProgress += (CharacterWeight * UnlockedCharacterCount / TotalCharacters);
+    TotalProgress += (MapWeight * CompletedMapLevels / TotalMaps);
+    TotalProgress += (AchievementWeight * CompletedAchievements.Num() / TotalAchievements);
+    TotalProgress += (CardWeight * CollectedCards.Num() / TotalCards);
+
+    CachedCompletionPercentage = FMath::Clamp(TotalProgress, 0.0f, 100.0f);
+}
+
+// =====================================================
+// Queries
+// =====================================================
+
+bool UYCRSaveGame::IsAchievementUnlocked(EYCRAchievementID AchievementID) const
+{
+    const int32 Index = static_cast<int32>(AchievementID);
+    return UnlockedAchievementBits.IsValidIndex(Index) && UnlockedAchievementBits[Index];
+}
+
+bool UYCRSaveGame::IsCharacterUnlocked(const FName& CharacterClass) const
+{
+    const int32* Slot = CharacterSlots.Find(CharacterClass);
+    return Slot && UnlockedCharacters[*Slot].bIsUnlocked;
+}
+
+bool UYCRSaveGame::IsClassUnlocked(EYCRCharacterClasses CharacterClass) const
+{
+    const int32 ClassValue = static_cast<int32>(CharacterClass);
+    const int32 Slot = ClassSlots.IsValidIndex(ClassValue) ? ClassSlots[ClassValue] : INDEX_NONE;
+    return Slot != INDEX_NONE && UnlockedCharacters[Slot].bIsUnlocked;
+}
+
+int32 UYCRSaveGame::GetCharacterAdvancementLevel(const FName& CharacterClass) const
+{
+    const int32* Slot = CharacterSlots.Find(CharacterClass);
+    return Slot ? UnlockedCharacters[*Slot].AdvancementLevel : 0;
+}
+
+int32 UYCRSaveGame::GetCardCount(const FName& CardID) const
+{
+    const int32* Slot = CardSlots.Find(CardID);
+    return Slot ? CollectedCards[*Slot].Count : 0;
 }
 
 bool UYCRSaveGame::IsAchievementCompleted(const FName& AchievementID) const
 {
-    for (const FAchievementSaveData& Achievement : CompletedAchievements)
+    const int32* Slot = AchievementSlots.Find(AchievementID);
+    return Slot && CompletedAchievements[*Slot].bIsCompleted;
+}
+
+// =====================================================
+// Mutation
+// =====================================================
+
+void UYCRSaveGame::UnlockAchievement(EYCRAchievementID AchievementID)
+{
+    const int32 Index = static_cast<int32>(AchievementID);
+    if (UnlockedAchievementBits.IsValidIndex(Index) && !UnlockedAchievementBits[Index])
     {
-        if (Achievement.AchievementID == AchievementID)
-        {
-            return Achievement.bIsCompleted;
-        }
+        UnlockedAchievements.Add(AchievementID);
+        UnlockedAchievementBits[Index] = true;
     }
-    return false;
 }
 
-float UYCRSaveGame::GetCompletionPercentage() const
+void UYCRSaveGame::UnlockCharacter(const FName& CharacterClass, int32 AdvancementLevel)
 {
-    float TotalProgress = 0.0f;
-    
-    // Characters unlocked (20%)
-    const float CharacterWeight = 20.0f;
-    const int32 TotalCharacters = 6; // Base classes
-    int32 UnlockedCount = 0;
-    for (const FCharacterUnlockData& CharData : UnlockedCharacters)
+    if (const int32* Slot = CharacterSlots.Find(CharacterClass))
     {
-        if (CharData.bIsUnlocked)
+        FCharacterUnlockData& CharData = UnlockedCharacters[*Slot];
+        if (!CharData.bIsUnlocked)
         {
-            UnlockedCount++;
+            CharData.bIsUnlocked = true;
+            UnlockedCharacterCount++;
         }
+        CharData.AdvancementLevel = FMath::Max(CharData.AdvancementLevel, AdvancementLevel);
     }
-    TotalProgress += (CharacterWeight * UnlockedCount / TotalCharacters);
-    
-    // Maps completed (40%)
-    const float MapWeight = 40.0f;
-    const int32 TotalMaps = 20; // 4 regions x 5 levels
-    int32 CompletedMaps = 0;
-    for (const auto& MapPair : MapProgress)
+    else
     {
-        CompletedMaps += FMath::Min(MapPair.Value.HighestLevelCompleted, 5);
+        const int32 NewSlot = UnlockedCharacters.Num();
+        FCharacterUnlockData& CharData = UnlockedCharacters.AddDefaulted_GetRef();
+        CharData.CharacterClass = CharacterClass;
+        CharData.AdvancementLevel = AdvancementLevel;
+        CharData.bIsUnlocked = true;
+        UnlockedCharacterCount++;
+
+        CharacterSlots.Add(CharacterClass, NewSlot);
+        const int32 ClassValue = static_cast<int32>(StaticEnum<EYCRCharacterClasses>()->GetValueByNameString(CharacterClass.ToString()));
+        if (ClassSlots.IsValidIndex(ClassValue))
+        {
+            ClassSlots[ClassValue] = NewSlot;
+        }
     }
-    TotalProgress += (MapWeight * CompletedMaps / TotalMaps);
-    
-    // Achievements (30%)
-    const float AchievementWeight = 30.0f;
-    const int32 TotalAchievements = 100; // Annahme
-    TotalProgress += (AchievementWeight * CompletedAchievements.Num() / TotalAchievements);
-    
-    // Cards collected (10%)
-    const float CardWeight = 10.0f;
-    const int32 TotalCards = 50; // Annahme
-    TotalProgress += (CardWeight * CollectedCards.Num() / TotalCards);
-    
-    return FMath::Clamp(TotalProgress, 0.0f, 100.0f);
+
+    UpdateCompletionPercentage();
 }
 
-void UYCRSaveGame::UpdatePlayStatistics(float SessionTime, const FName& PlayedCharacter)
+void UYCRSaveGame::AddCard(const FName& CardID, int32 Count)
 {
-    TotalPlayTime += SessionTime;
-    TotalRuns++;
-    
-    // Update character play count
-    if (CharacterPlayCounts.Contains(PlayedCharacter))
+    if (const int32* Slot = CardSlots.Find(CardID))
     {
-        CharacterPlayCounts[PlayedCharacter]++;
+        CollectedCards[*Slot].Count += Count;
+        return;
+    }
+
+    CardSlots.Add(CardID, CollectedCards.Num());
+    FCardSaveData& CardData = CollectedCards.AddDefaulted_GetRef();
+    CardData.CardID = CardID;
+    CardData.Count = Count;
+
+    UpdateCompletionPercentage();
+}
+
+void UYCRSaveGame::CompleteAchievement(const FName& AchievementID)
+{
+    if (const int32* Slot = AchievementSlots.Find(AchievementID))
+    {
+        FAchievementSaveData& Achievement = CompletedAchievements[*Slot];
+        if (Achievement.bIsCompleted)
+        {
+            return;
+        }
+        Achievement.bIsCompleted = true;
     }
     else
     {
-        CharacterPlayCounts.Add(PlayedCharacter, 1);
+        AchievementSlots.Add(AchievementID, CompletedAchievements.Num());
+        FAchievementSaveData& Achievement = CompletedAchievements.AddDefaulted_GetRef();
+        Achievement.AchievementID = AchievementID;
+        Achievement.bIsCompleted = true;
+    }
+
+    // Completion counts every recorded achievement entry, as it always has
+    UpdateCompletionPercentage();
+}
+
+void UYCRSaveGame::SetMapLevelCompleted(const FName& MapName, int32 Level)
+{
+    FMapProgressData& Progress = MapProgress.FindOrAdd(MapName);
+    if (Level <= Progress.HighestLevelCompleted)
+    {
+        return;
     }
+
+    const int32 OldCounted = FMath::Min(Progress.HighestLevelCompleted, YCRSaveGameCompletion::LevelsPerMap);
+    Progress.HighestLevelCompleted = Level;
+    CompletedMapLevels += FMath::Min(Level, YCRSaveGameCompletion::LevelsPerMap) - OldCounted;
+
+    UpdateCompletionPercentage();
+}
+
+void UYCRSaveGame::UpdatePlayStatistics(float SessionTime, const FName& PlayedCharacter)
+{
+    TotalPlayTime += SessionTime;
+    TotalRuns++;
     
-    // Update most played character
-    int32 HighestPlayCount = 0;
-    for (const auto& CharPair : CharacterPlayCounts)
+    // Update character play count, the most played character can only change to this one
+    const int32 PlayCount = ++CharacterPlayCounts.FindOrAdd(PlayedCharacter, 0);
+    const int32* HighestPlayCount = CharacterPlayCounts.Find(MostPlayedCharacter);
+    if (!HighestPlayCount || PlayCount > *HighestPlayCount)
     {
-        if (CharPair.Value > HighestPlayCount)
-        {
-            HighestPlayCount = CharPair.Value;
-            MostPlayedCharacter = CharPair.Key;
-        }
+        MostPlayedCharacter = PlayedCharacter;
     }
     
     LastSaveTime = FDateTime::Now();
-}
\ No newline at end of file
+}
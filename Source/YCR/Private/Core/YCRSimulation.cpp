@@ -0,0 +1,88 @@
+﻿#include "Core/YCRSimulation.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+TStaticArray<FYCRSimulation::FCost, static_cast<int32>(EYCRSimulationCost::MAX)> FYCRSimulation::Costs;
+int64 FYCRSimulation::FrameCount = 0;
+double FYCRSimulation::StartWallTime = 0.0;
+FYCRSimulationScope* FYCRSimulationScope::Current = nullptr;
+
+bool FYCRSimulation::IsEnabled()
+{
+    static const bool bEnabled = FParse::Param(FCommandLine::Get(), TEXT("YCRSimulate"));
+    return bEnabled;
+}
+
+float FYCRSimulation::GetFixedDeltaTime()
+{
+    static const float FixedDeltaTime = []()
+    {
+        float StepsPerSecond = 30.0f;
+        FParse::Value(FCommandLine::Get(), TEXT("YCRSimFPS="), StepsPerSecond);
+        return 1.0f / FMath::Clamp(StepsPerSecond, 1.0f, 240.0f);
+    }();
+    return FixedDeltaTime;
+}
+
+float FYCRSimulation::GetMaxRunTime(float DefaultTime)
+{
+    // Negative = not given on the command line
+    static const float MaxTime = []()
+    {
+        float Value = -1.0f;
+        FParse::Value(FCommandLine::Get(), TEXT("YCRSimMaxTime="), Value);
+        return Value;
+    }();
+    return MaxTime >= 0.0f ? MaxTime : DefaultTime;
+}
+
+void FYCRSimulation::Begin(UWorld* World)
+{
+    // Fixed delta plus benchmarking: the engine never waits for wall time between frames
+    FApp::SetUseFixedTimeStep(true);
+    FApp::SetFixedDeltaTime(GetFixedDeltaTime());
+    FApp::SetBenchmarking(true);
+
+    if (GEngine)
+    {
+        GEngine->bEnableOnScreenDebugMessages = false;
+    }
+
+    if (World)
+    {
+        World->bAllowAudioPlayback = false;
+    }
+
+    for (FCost& Cost : Costs)
+    {
+        Cost = FCost();
+    }
+    FrameCount = 0;
+    StartWallTime = FPlatformTime::Seconds();
+
+    UE_LOG(LogTemp, Display, TEXT("YCR simulation started (fixed delta %.4f s)"), FApp::GetFixedDeltaTime());
+}
+
+void FYCRSimulation::Finish(float RunTime, bool bVictory)
+{
+    const double WallTime = FMath::Max(FPlatformTime::Seconds() - StartWallTime, UE_DOUBLE_SMALL_NUMBER);
+    const int64 Frames = FMath::Max<int64>(FrameCount, 1);
+
+    UE_LOG(LogTemp, Display, TEXT("YCR simulation finished - Victory: %s, run time %.1f s, wall time %.1f s (%.1fx), %lld frames"),
+        bVictory ? TEXT("Yes") : TEXT("No"), RunTime, WallTime, RunTime / WallTime, FrameCount);
+    UE_LOG(LogTemp, Display, TEXT("%-12s %10s %10s %8s %10s"), TEXT("Subsystem"), TEXT("Total ms"), TEXT("ms/frame"),
+        TEXT("% wall"), TEXT("Calls"));
+
+    for (int32 i = 0; i < Costs.Num(); i++)
+    {
+        const double TotalMs = FPlatformTime::ToMilliseconds64(Costs[i].Cycles);
+        UE_LOG(LogTemp, Display, TEXT("%-12s %10.1f %10.3f %7.1f%% %10lld"),
+            *UEnum::GetDisplayValueAsText(static_cast<EYCRSimulationCost>(i)).ToString(),
+            TotalMs, TotalMs / Frames, TotalMs / (WallTime * 10.0), Costs[i].Calls);
+    }
+
+    FPlatformMisc::RequestExit(false, TEXT("FYCRSimulation::Finish"));
+}
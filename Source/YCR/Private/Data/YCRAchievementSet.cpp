@@ -0,0 +1,54 @@
+﻿// Copyright YCR Project
+
+#include "Data/YCRAchievementSet.h"
+
+UYCRAchievementSet::UYCRAchievementSet()
+{
+    ResetToDefaults();
+}
+
+void UYCRAchievementSet::ResetToDefaults()
+{
+    Achievements.Reset();
+
+    auto AddAchievement = [this](EYCRAchievementID AchievementID,
+        std::initializer_list<TTuple<const TCHAR*, EYCRAchievementComparison, int64>> Conditions)
+    {
+        FYCRAchievementDefinition& Definition = Achievements.AddDefaulted_GetRef();
+        Definition.AchievementID = AchievementID;
+        for (const TTuple<const TCHAR*, EYCRAchievementComparison, int64>& Condition : Conditions)
+        {
+            FYCRAchievementCondition& NewCondition = Definition.Conditions.AddDefaulted_GetRef();
+            NewCondition.Counter = Condition.Get<0>();
+            NewCondition.Comparison = Condition.Get<1>();
+            NewCondition.Threshold = Condition.Get<2>();
+        }
+    };
+
+    constexpr EYCRAchievementComparison AtLeast = EYCRAchievementComparison::AtLeast;
+    constexpr EYCRAchievementComparison AtMost = EYCRAchievementComparison::AtMost;
+
+    // "First Blood" - Kill 1 monster
+    AddAchievement(EYCRAchievementID::FirstBlood, { { TEXT("Run.MonstersKilled"), AtLeast, 1 } });
+
+    // "Monster Hunter" - Kill 100 monsters in one run
+    AddAchievement(EYCRAchievementID::MonsterHunter, { { TEXT("Run.MonstersKilled"), AtLeast, 100 } });
+
+    // "Elite Slayer" - Kill 10 elites in one run
+    AddAchievement(EYCRAchievementID::EliteSlayer, { { TEXT("Run.ElitesKilled"), AtLeast, 10 } });
+
+    // "Boss Killer" - Kill your first boss
+    AddAchievement(EYCRAchievementID::BossKiller, { { TEXT("Run.BossesKilled"), AtLeast, 1 } });
+
+    // "Rich" - Collect 1000 gold in one run
+    AddAchievement(EYCRAchievementID::GoldCollector, { { TEXT("Run.GoldCollected"), AtLeast, 1000 } });
+
+    // "Speedrunner" - Complete a level in under 5 minutes
+    AddAchievement(EYCRAchievementID::Speedrunner, {
+        { TEXT("Run.DurationSeconds"), AtMost, 299 },
+        { TEXT("Run.Level"), AtLeast, 2 } });
+
+    // Total progress achievements
+    AddAchievement(EYCRAchievementID::Exterminator, { { TEXT("Total.MonstersKilled"), AtLeast, 1000 } });
+    AddAchievement(EYCRAchievementID::Veteran, { { TEXT("Total.RunsWon"), AtLeast, 10 } });
+}
@@ -0,0 +1,109 @@
+﻿#include "Data/YCRLevelCurves.h"
+#include "Algo/BinarySearch.h"
+
+namespace YCRLevelCurves
+{
+    struct FScaleTable
+    {
+        /** Indexed by curve, then level ([0] unused) */
+        TStaticArray<TStaticArray<float, FYCRLevelCurves::MaxLevel + 1>, static_cast<int32>(EYCRLevelCurve::MAX)> Scales;
+
+        FScaleTable()
+        {
+            BakeGrowth(EYCRLevelCurve::MonsterHealth, FYCRLevelCurves::MonsterHealthGrowth);
+            BakeGrowth(EYCRLevelCurve::MonsterAttack, FYCRLevelCurves::MonsterAttackGrowth);
+            BakeGrowth(EYCRLevelCurve::MonsterDefense, FYCRLevelCurves::MonsterDefenseGrowth);
+            BakeLinear(EYCRLevelCurve::MonsterExperience, FYCRLevelCurves::MonsterExperiencePerLevel);
+            BakeLinear(EYCRLevelCurve::MonsterGold, FYCRLevelCurves::MonsterGoldPerLevel);
+        }
+
+        void BakeGrowth(EYCRLevelCurve Curve, double GrowthRate)
+        {
+            TStaticArray<float, FYCRLevelCurves::MaxLevel + 1>& Values = Scales[static_cast<int32>(Curve)];
+            Values[0] = 0.0f;
+
+            double Scale = 1.0;
+            for (int32 Level = 1; Level <= FYCRLevelCurves::MaxLevel; Level++)
+            {
+                Values[Level] = static_cast<float>(Scale);
+                Scale *= GrowthRate;
+            }
+        }
+
+        void BakeLinear(EYCRLevelCurve Curve, double PerLevel)
+        {
+            TStaticArray<float, FYCRLevelCurves::MaxLevel + 1>& Values = Scales[static_cast<int32>(Curve)];
+            Values[0] = 0.0f;
+
+            for (int32 Level = 1; Level <= FYCRLevelCurves::MaxLevel; Level++)
+            {
+                Values[Level] = static_cast<float>(1.0 + Level * PerLevel);
+            }
+        }
+    };
+
+    static const FScaleTable& GetScaleTable()
+    {
+        static const FScaleTable Table;
+        return Table;
+    }
+
+    struct FExperienceTable
+    {
+        /** Indexed by level, [0] unused */
+        TStaticArray<double, FYCRLevelCurves::MaxLevel + 1> ToNextLevel;
+        TStaticArray<double, FYCRLevelCurves::MaxLevel + 1> TotalForLevel;
+
+        FExperienceTable()
+        {
+            ToNextLevel[0] = 0.0;
+            TotalForLevel[0] = 0.0;
+            TotalForLevel[1] = 0.0;
+
+            double Required = FYCRLevelCurves::BaseExperienceToLevel;
+            for (int32 Level = 1; Level <= FYCRLevelCurves::MaxLevel; Level++)
+            {
+                ToNextLevel[Level] = Required;
+                if (Level < FYCRLevelCurves::MaxLevel)
+                {
+                    TotalForLevel[Level + 1] = TotalForLevel[Level] + Required;
+                }
+                Required = FMath::RoundToDouble(Required * FYCRLevelCurves::ExperienceGrowth);
+            }
+        }
+    };
+
+    static const FExperienceTable& GetExperienceTable()
+    {
+        static const FExperienceTable Table;
+        return Table;
+    }
+}
+
+float FYCRLevelCurves::GetScale(EYCRLevelCurve Curve, int32 Level)
+{
+    const int32 CurveIndex = static_cast<int32>(Curve);
+    if (CurveIndex < 0 || CurveIndex >= static_cast<int32>(EYCRLevelCurve::MAX))
+    {
+        return 1.0f;
+    }
+    return YCRLevelCurves::GetScaleTable().Scales[CurveIndex][FMath::Clamp(Level, 1, MaxLevel)];
+}
+
+float FYCRLevelCurves::GetExperienceToNextLevel(int32 Level)
+{
+    return static_cast<float>(YCRLevelCurves::GetExperienceTable().ToNextLevel[FMath::Clamp(Level, 1, MaxLevel)]);
+}
+
+double FYCRLevelCurves::GetTotalExperienceForLevel(int32 Level)
+{
+    return YCRLevelCurves::GetExperienceTable().TotalForLevel[FMath::Clamp(Level, 1, MaxLevel)];
+}
+
+int32 FYCRLevelCurves::GetLevelForTotalExperience(double TotalExperience)
+{
+    // Totals are ascending from level 1, the last one not above TotalExperience is the level
+    const TStaticArray<double, MaxLevel + 1>& Totals = YCRLevelCurves::GetExperienceTable().TotalForLevel;
+    const TArrayView<const double> Levels(&Totals[1], MaxLevel);
+    return FMath::Clamp(static_cast<int32>(Algo::UpperBound(Levels, TotalExperience)), 1, MaxLevel);
+}
@@ -0,0 +1,285 @@
+﻿// Copyright YCR Project
+
+#include "Data/YCRLootTable.h"
+
+// =====================================================
+// Alias Sampler
+// =====================================================
+
+void FYCRAliasSampler::Build(TConstArrayView<float> Weights)
+{
+    Probability.Reset();
+    Alias.Reset();
+
+    const int32 Num = Weights.Num();
+    float TotalWeight = 0.0f;
+    for (const float Weight : Weights)
+    {
+        TotalWeight += FMath::Max(0.0f, Weight);
+    }
+
+    if (Num == 0 || TotalWeight <= 0.0f)
+    {
+        return;
+    }
+
+    Probability.SetNumUninitialized(Num);
+    Alias.SetNumUninitialized(Num);
+
+    // Scale so the average column holds exactly 1.0
+    TArray<float, TInlineAllocator<16>> Scaled;
+    Scaled.SetNumUninitialized(Num);
+
+    TArray<int32, TInlineAllocator<16>> Small;
+    TArray<int32, TInlineAllocator<16>> Large;
+
+    for (int32 i = 0; i < Num; i++)
+    {
+        Scaled[i] = FMath::Max(0.0f, Weights[i]) * Num / TotalWeight;
+        Alias[i] = i;
+
+        if (Scaled[i] < 1.0f)
+        {
+            Small.Add(i);
+        }
+        else
+        {
+            Large.Add(i);
+        }
+    }
+
+    // Vose: pair every under-full column with an over-full donor
+    while (Small.Num() > 0 && Large.Num() > 0)
+    {
+        const int32 Less = Small.Pop(EAllowShrinking::No);
+        const int32 More = Large.Pop(EAllowShrinking::No);
+
+        Probability[Less] = Scaled[Less];
+        Alias[Less] = More;
+
+        Scaled[More] = (Scaled[More] + Scaled[Less]) - 1.0f;
+        if (Scaled[More] < 1.0f)
+        {
+            Small.Add(More);
+        }
+        else
+        {
+            Large.Add(More);
+        }
+    }
+
+    // Remaining columns are full (up to float error)
+    for (const int32 Index : Large)
+    {
+        Probability[Index] = 1.0f;
+    }
+    for (const int32 Index : Small)
+    {
+        Probability[Index] = 1.0f;
+    }
+}
+
+// =====================================================
+// Loot Table
+// =====================================================
+
+UYCRLootTable::UYCRLootTable()
+{
+    ResetToDefaults();
+    CompileTables();
+}
+
+void UYCRLootTable::PostLoad()
+{
+    Super::PostLoad();
+
+    CompileTables();
+}
+
+#if WITH_EDITOR
+void UYCRLootTable::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+
+    CompileTables();
+}
+#endif
+
+void UYCRLootTable::ResetToDefaults()
+{
+    MonsterTables.Reset();
+
+    auto AddMonster = [this](EYCRMonsterType Type, float ExpMultiplier, int32 MinCoins, int32 MaxCoins,
+        float GemChance, EYCRGemColor GemColor)
+    {
+        FYCRMonsterLootTable& Table = MonsterTables.AddDefaulted_GetRef();
+        Table.MonsterType = Type;
+        Table.ExpMultiplier = ExpMultiplier;
+
+        // Coins always drop, amount varies for stronger monsters
+        FYCRLootGroup& CoinGroup = Table.Groups.AddDefaulted_GetRef();
+        CoinGroup.GroupName = TEXT("Coins");
+        FYCRLootEntry& Coins = CoinGroup.Entries.AddDefaulted_GetRef();
+        Coins.DropKind = EYCRLootDropKind::Coins;
+        Coins.MinAmount = MinCoins;
+        Coins.MaxAmount = MaxCoins;
+
+        // Out-game gem chance expressed as gem vs. nothing
+        FYCRLootGroup& GemGroup = Table.Groups.AddDefaulted_GetRef();
+        GemGroup.GroupName = TEXT("OutGameGem");
+        FYCRLootEntry& Gem = GemGroup.Entries.AddDefaulted_GetRef();
+        Gem.DropKind = EYCRLootDropKind::OutGameGem;
+        Gem.Weight = GemChance;
+        Gem.GemColor = GemColor;
+        if (GemChance < 100.0f)
+        {
+            FYCRLootEntry& Nothing = GemGroup.Entries.AddDefaulted_GetRef();
+            Nothing.DropKind = EYCRLootDropKind::Nothing;
+            Nothing.Weight = 100.0f - GemChance;
+        }
+    };
+
+    // Type, Exp multiplier, Coins (min/max = base ±10%), Gem chance %, Gem colour
+    AddMonster(EYCRMonsterType::Normal,   1.0f,   1,   1,   1.0f,   EYCRGemColor::White);
+    AddMonster(EYCRMonsterType::Elite,    3.0f,   3,   3,   5.0f,   EYCRGemColor::Green);
+    AddMonster(EYCRMonsterType::MiniBoss, 10.0f,  9,   11,  25.0f,  EYCRGemColor::Blue);
+    AddMonster(EYCRMonsterType::Boss,     50.0f,  90,  110, 100.0f, EYCRGemColor::Purple);
+    AddMonster(EYCRMonsterType::Special,  100.0f, 90,  110, 100.0f, EYCRGemColor::Purple);
+}
+
+void UYCRLootTable::CompileTables()
+{
+    for (FCompiledMonsterLoot& Compiled : CompiledLoot)
+    {
+        Compiled = FCompiledMonsterLoot();
+    }
+
+    for (const FYCRMonsterLootTable& Table : MonsterTables)
+    {
+        const int32 TypeIndex = static_cast<int32>(Table.MonsterType);
+        if (!CompiledLoot.IsValidIndex(TypeIndex))
+        {
+            continue;
+        }
+
+        FCompiledMonsterLoot& Compiled = CompiledLoot[TypeIndex];
+        Compiled.ExpMultiplier = Table.ExpMultiplier;
+
+        for (const FYCRLootGroup& Group : Table.Groups)
+        {
+            if (Group.RollCount <= 0 || Group.Entries.IsEmpty())
+            {
+                continue;
+            }
+
+            TArray<float, TInlineAllocator<16>> Weights;
+            float TotalWeight = 0.0f;
+            for (const FYCRLootEntry& Entry : Group.Entries)
+            {
+                Weights.Add(Entry.Weight);
+                TotalWeight += FMath::Max(0.0f, Entry.Weight);
+            }
+
+            FCompiledGroup CompiledGroup;
+            CompiledGroup.Sampler.Build(Weights);
+            if (CompiledGroup.Sampler.IsEmpty())
+            {
+                UE_LOG(LogTemp, Warning, TEXT("YCRLootTable %s: group %s for %s has no positive weights"),
+                    *GetName(), *Group.GroupName.ToString(), *UEnum::GetValueAsString(Table.MonsterType));
+                continue;
+            }
+
+            CompiledGroup.Entries = Group.Entries;
+            CompiledGroup.TotalWeight = TotalWeight;
+            CompiledGroup.RollCount = Group.RollCount;
+            Compiled.Groups.Add(MoveTemp(CompiledGroup));
+        }
+    }
+}
+
+const UYCRLootTable::FCompiledMonsterLoot& UYCRLootTable::GetCompiled(EYCRMonsterType MonsterType) const
+{
+    const int32 TypeIndex = static_cast<int32>(MonsterType);
+    return CompiledLoot.IsValidIndex(TypeIndex) ? CompiledLoot[TypeIndex] : CompiledLoot[0];
+}
+
+void UYCRLootTable::RollLoot(const FYCRLootRollRequest& Request, const FRandomStream& Stream,
+    TArray<FYCRLootDrop>& OutDrops, int32 RequestIndex) const
+{
+    const FCompiledMonsterLoot& Compiled = GetCompiled(Request.MonsterType);
+
+    for (const FCompiledGroup& Group : Compiled.Groups)
+    {
+        for (int32 Roll = 0; Roll < Group.RollCount; Roll++)
+        {
+            const FYCRLootEntry& Entry = Group.Entries[Group.Sampler.Sample(Stream.GetFraction())];
+            if (Entry.DropKind == EYCRLootDropKind::Nothing)
+            {
+                continue;
+            }
+
+            FYCRLootDrop& Drop = OutDrops.AddDefaulted_GetRef();
+            Drop.RequestIndex = RequestIndex;
+            Drop.DropKind = Entry.DropKind;
+            Drop.Amount = Entry.MinAmount < Entry.MaxAmount
+                ? Stream.RandRange(Entry.MinAmount, Entry.MaxAmount)
+                : Entry.MinAmount;
+            Drop.GemColor = Entry.GemColor;
+            Drop.BuffType = Entry.BuffType;
+            Drop.ItemID = Entry.ItemID;
+        }
+    }
+}
+
+void UYCRLootTable::RollLootBatch(TConstArrayView<FYCRLootRollRequest> Requests, const FRandomStream& Stream,
+    TArray<FYCRLootDrop>& OutDrops) const
+{
+    // Every kill yields roughly one drop per group
+    OutDrops.Reserve(OutDrops.Num() + Requests.Num() * 2);
+
+    for (int32 i = 0; i < Requests.Num(); i++)
+    {
+        RollLoot(Requests[i], Stream, OutDrops, i);
+    }
+}
+
+int32 UYCRLootTable::GetExperienceFor(EYCRMonsterType MonsterType, int32 MonsterLevel) const
+{
+    return FMath::RoundToInt(BaseExperience * GetExpMultiplier(MonsterType) * MonsterLevel);
+}
+
+float UYCRLootTable::GetExpMultiplier(EYCRMonsterType MonsterType) const
+{
+    return GetCompiled(MonsterType).ExpMultiplier;
+}
+
+float UYCRLootTable::GetDropChance(EYCRMonsterType MonsterType, EYCRLootDropKind DropKind) const
+{
+    float Chance = 0.0f;
+    for (const FCompiledGroup& Group : GetCompiled(MonsterType).Groups)
+    {
+        for (const FYCRLootEntry& Entry : Group.Entries)
+        {
+            if (Entry.DropKind == DropKind)
+            {
+                Chance += FMath::Max(0.0f, Entry.Weight) / Group.TotalWeight * Group.RollCount;
+            }
+        }
+    }
+    return FMath::Clamp(Chance * 100.0f, 0.0f, 100.0f);
+}
+
+EYCRGemColor UYCRLootTable::GetGemColor(EYCRMonsterType MonsterType) const
+{
+    for (const FCompiledGroup& Group : GetCompiled(MonsterType).Groups)
+    {
+        for (const FYCRLootEntry& Entry : Group.Entries)
+        {
+            if (Entry.DropKind == EYCRLootDropKind::OutGameGem)
+            {
+                return Entry.GemColor;
+            }
+        }
+    }
+    return EYCRGemColor::White;
+}
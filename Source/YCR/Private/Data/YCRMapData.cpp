@@ -0,0 +1,13 @@
+﻿#include "Data/YCRMapData.h"
+#include "Data/YCRPrimaryAssetTypes.h"
+
+FPrimaryAssetId UYCRMapData::GetPrimaryAssetId() const
+{
+    // Keyed by map name so the menu can build the id from the level it is about to open
+    return MakePrimaryAssetId(MapName.IsNone() ? GetFName() : MapName);
+}
+
+FPrimaryAssetId UYCRMapData::MakePrimaryAssetId(FName InMapName)
+{
+    return FPrimaryAssetId(FYCRPrimaryAssetTypes::Map, InMapName);
+}
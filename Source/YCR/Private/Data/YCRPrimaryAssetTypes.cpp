@@ -0,0 +1,9 @@
+﻿#include "Data/YCRPrimaryAssetTypes.h"
+
+const FPrimaryAssetType FYCRPrimaryAssetTypes::CharacterCreation = TEXT("YCRCharacterCreation");
+const FPrimaryAssetType FYCRPrimaryAssetTypes::Gems = TEXT("YCRGems");
+const FPrimaryAssetType FYCRPrimaryAssetTypes::Map = TEXT("YCRMap");
+
+const FName FYCRAssetBundles::Menu = TEXT("Menu");
+const FName FYCRAssetBundles::InRun = TEXT("InRun");
+const FName FYCRAssetBundles::Boss = TEXT("Boss");
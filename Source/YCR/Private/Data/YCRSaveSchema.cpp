@@ -0,0 +1,466 @@
+﻿#include "Data/YCRSaveSchema.h"
+#include "Core/YCRSaveGame.h"
+#include "Enums/EYCRAchievementID.h"
+#include "Enums/EYCRCharacterClasses.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Crc.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace YCRSaveSchema
+{
+    // "YCRS" - legacy tagged saves start with the engine's "GVAS" header instead
+    constexpr uint32 Magic = 0x53524359;
+
+    static_assert(static_cast<int32>(EYCRCharacterClasses::MAX) <= 64, "Class bitset is stored as uint64");
+
+    // Writes and reads non-negative counters as variable length integers
+    void WritePacked(FArchive& Ar, int32 Value)
+    {
+        uint32 PackedValue = static_cast<uint32>(FMath::Max(Value, 0));
+        Ar.SerializeIntPacked(PackedValue);
+    }
+
+    int32 ReadPacked(FArchive& Ar)
+    {
+        uint32 PackedValue = 0;
+        Ar.SerializeIntPacked(PackedValue);
+        return static_cast<int32>(FMath::Min<uint32>(PackedValue, MAX_int32));
+    }
+
+    void WriteName(FArchive& Ar, const FName& Name)
+    {
+        FString NameString = Name.ToString();
+        Ar << NameString;
+    }
+
+    FName ReadName(FArchive& Ar)
+    {
+        FString NameString;
+        Ar << NameString;
+        return FName(*NameString);
+    }
+
+    // Achievement IDs stored as strings by UGameInstanceYCR, indexed by EYCRAchievementID
+    const TArray<FString>& GetAchievementNames()
+    {
+        static_assert(static_cast<int32>(EYCRAchievementID::MAX) == 9, "Add the new achievement to the name table");
+
+        static const TArray<FString> Names = {
+            TEXT(""),               // None
+            TEXT("FirstBlood"),     // FirstBlood
+            TEXT("BossKiller"),     // BossKiller
+            TEXT("Rich"),           // GoldCollector
+            TEXT("MonsterHunter"),  // MonsterHunter
+            TEXT("EliteSlayer"),    // EliteSlayer
+            TEXT("Speedrunner"),    // Speedrunner
+            TEXT("Exterminator"),   // Exterminator
+            TEXT("Veteran"),        // Veteran
+        };
+        return Names;
+    }
+}
+
+// =====================================================
+// Achievement IDs
+// =====================================================
+
+const FString& FYCRSaveSchema::GetAchievementName(uint8 AchievementID)
+{
+    const TArray<FString>& Names = YCRSaveSchema::GetAchievementNames();
+    return Names.IsValidIndex(AchievementID) ? Names[AchievementID] : Names[0];
+}
+
+int32 FYCRSaveSchema::FindAchievementID(const FString& AchievementName)
+{
+    const int32 Index = YCRSaveSchema::GetAchievementNames().IndexOfByKey(AchievementName);
+    return Index > 0 ? Index : INDEX_NONE;
+}
+
+// =====================================================
+// Write
+// =====================================================
+
+void FYCRSaveSchema::Write(const FYCRSaveProfile& Profile, TArray<uint8>& OutBytes)
+{
+    using namespace YCRSaveSchema;
+
+    const FPlayerProgressData& Progress = Profile.Progress;
+    const UEnum* ClassEnum = StaticEnum<EYCRCharacterClasses>();
+
+    TArray<uint8> Payload;
+    Payload.Reserve(256);
+    FMemoryWriter Ar(Payload);
+
+    int64 JournalSequence = Profile.JournalSequence;
+    int64 SaveTicks = Profile.LastSaveTime.GetTicks();
+    Ar << JournalSequence;
+    Ar << SaveTicks;
+
+    WritePacked(Ar, Progress.HighestMapUnlocked);
+    WritePacked(Ar, Progress.HighestLevelReached);
+    WritePacked(Ar, Progress.TotalEssence);
+    WritePacked(Ar, Progress.TotalRunsPlayed);
+    WritePacked(Ar, Progress.TotalRunsWon);
+    WritePacked(Ar, Progress.TotalMonstersKilled);
+    WritePacked(Ar, Progress.TotalElitesKilled);
+    WritePacked(Ar, Progress.TotalBossesKilled);
+    WritePacked(Ar, Progress.TotalGoldCollected);
+
+    // Characters: class bitset + one advancement byte per set bit, unknown names verbatim
+    uint64 ClassBits = 0;
+    TArray<uint8, TInlineAllocator<64>> ClassLevels;
+    ClassLevels.SetNumZeroed(static_cast<int32>(EYCRCharacterClasses::MAX));
+    TArray<TPair<FName, int32>> UnknownCharacters;
+    for (const TPair<FName, int32>& Character : Progress.UnlockedCharacters)
+    {
+        const int32 ClassValue = static_cast<int32>(ClassEnum->GetValueByNameString(Character.Key.ToString()));
+        if (ClassValue > 0 && ClassValue < static_cast<int32>(EYCRCharacterClasses::MAX))
+        {
+            ClassBits |= 1ull << ClassValue;
+            ClassLevels[ClassValue] = static_cast<uint8>(FMath::Clamp(Character.Value, 0, 255));
+        }
+        else
+        {
+            UnknownCharacters.Emplace(Character.Key, Character.Value);
+        }
+    }
+    Ar << ClassBits;
+    for (int32 ClassValue = 0; ClassValue < ClassLevels.Num(); ClassValue++)
+    {
+        if (ClassBits & (1ull << ClassValue))
+        {
+            Ar << ClassLevels[ClassValue];
+        }
+    }
+    WritePacked(Ar, UnknownCharacters.Num());
+    for (const TPair<FName, int32>& Character : UnknownCharacters)
+    {
+        WriteName(Ar, Character.Key);
+        WritePacked(Ar, Character.Value);
+    }
+
+    // Achievements: bitset, unknown IDs verbatim
+    uint64 AchievementBits = 0;
+    TArray<FString> UnknownAchievements;
+    for (const FString& Achievement : Progress.UnlockedAchievements)
+    {
+        const int32 AchievementID = FindAchievementID(Achievement);
+        if (AchievementID != INDEX_NONE && AchievementID < 64)
+        {
+            AchievementBits |= 1ull << AchievementID;
+        }
+        else
+        {
+            UnknownAchievements.Add(Achievement);
+        }
+    }
+    Ar << AchievementBits;
+    WritePacked(Ar, UnknownAchievements.Num());
+    for (FString& Achievement : UnknownAchievements)
+    {
+        Ar << Achievement;
+    }
+
+    // Cards have no enum - name + packed count
+    WritePacked(Ar, Progress.CollectedCards.Num());
+    for (const TPair<FName, int32>& Card : Progress.CollectedCards)
+    {
+        WriteName(Ar, Card.Key);
+        WritePacked(Ar, Card.Value);
+    }
+
+    // Header
+    uint32 FileMagic = Magic;
+    uint16 Version = static_cast<uint16>(EYCRSaveVersion::Latest);
+    uint16 Reserved = 0;
+    uint32 PayloadSize = Payload.Num();
+    uint32 PayloadCrc = FCrc::MemCrc32(Payload.GetData(), Payload.Num());
+
+    OutBytes.Reset(Payload.Num() + 16);
+    FMemoryWriter FileWriter(OutBytes);
+    FileWriter << FileMagic;
+    FileWriter << Version;
+    FileWriter << Reserved;
+    FileWriter << PayloadSize;
+    FileWriter << PayloadCrc;
+    FileWriter.Serialize(Payload.GetData(), Payload.Num());
+}
+
+// =====================================================
+// Read + Migration
+// =====================================================
+
+bool FYCRSaveSchema::Read(TConstArrayView<uint8> Bytes, FYCRSaveProfile& OutProfile)
+{
+    OutProfile = FYCRSaveProfile();
+
+    FMemoryReaderView Ar(Bytes);
+    uint32 FileMagic = 0;
+    if (Bytes.Num() >= static_cast<int32>(sizeof(FileMagic)))
+    {
+        Ar << FileMagic;
+    }
+
+    if (FileMagic != YCRSaveSchema::Magic)
+    {
+        if (!ReadLegacyTagged(Bytes, OutProfile))
+        {
+            return false;
+        }
+        OutProfile.LoadedVersion = EYCRSaveVersion::LegacyTagged;
+    }
+    else
+    {
+        uint16 Version = 0;
+        uint16 Reserved = 0;
+        uint32 PayloadSize = 0;
+        uint32 PayloadCrc = 0;
+        Ar << Version;
+        Ar << Reserved;
+        Ar << PayloadSize;
+        Ar << PayloadCrc;
+
+        if (Ar.IsError() || Version < static_cast<uint16>(EYCRSaveVersion::CompactBinary))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Save file header is corrupt"));
+            return false;
+        }
+        if (Version > static_cast<uint16>(EYCRSaveVersion::Latest))
+        {
+            UE_LOG(LogTemp, Error, TEXT("Save file version %d was written by a newer build (latest known: %d)"),
+                Version, static_cast<int32>(EYCRSaveVersion::Latest));
+            return false;
+        }
+
+        const int64 PayloadOffset = Ar.Tell();
+        if (PayloadOffset + PayloadSize > Bytes.Num() ||
+            FCrc::MemCrc32(Bytes.GetData() + PayloadOffset, PayloadSize) != PayloadCrc)
+        {
+            UE_LOG(LogTemp, Error, TEXT("Save file payload is truncated or corrupt"));
+            return false;
+        }
+
+        FMemoryReaderView PayloadReader(Bytes.Slice(static_cast<int32>(PayloadOffset), static_cast<int32>(PayloadSize)));
+        OutProfile.LoadedVersion = static_cast<EYCRSaveVersion>(Version);
+
+        // One decoder per binary version
+        bool bDecoded = false;
+        switch (OutProfile.LoadedVersion)
+        {
+        case EYCRSaveVersion::CompactBinary:
+            bDecoded = ReadCompactBinary(PayloadReader, OutProfile);
+            break;
+
+        default:
+            break;
+        }
+
+        if (!bDecoded || PayloadReader.IsError())
+        {
+            UE_LOG(LogTemp, Error, TEXT("Failed to decode save file version %d"), Version);
+            return false;
+        }
+    }
+
+    // Upgrade one version at a time - step N migrates version N to N + 1
+    using FMigrationStep = void (*)(FYCRSaveProfile&);
+    static const FMigrationStep MigrationSteps[] =
+    {
+        nullptr,                                    // 0 - unused
+        &MigrateLegacyTaggedToCompactBinary,        // 1 -> 2
+    };
+    static_assert(UE_ARRAY_COUNT(MigrationSteps) == static_cast<int32>(EYCRSaveVersion::Latest),
+        "Every save version needs a migration step to the next one");
+
+    for (int32 Version = static_cast<int32>(OutProfile.LoadedVersion); Version < static_cast<int32>(EYCRSaveVersion::Latest); Version++)
+    {
+        MigrationSteps[Version](OutProfile);
+        UE_LOG(LogTemp, Log, TEXT("Migrated save from version %d to %d"), Version, Version + 1);
+    }
+
+    return true;
+}
+
+bool FYCRSaveSchema::ReadLegacyTagged(TConstArrayView<uint8> Bytes, FYCRSaveProfile& OutProfile)
+{
+    const TArray<uint8> SaveBytes(Bytes.GetData(), Bytes.Num());
+    const UYCRSaveGame* LegacySave = Cast<UYCRSaveGame>(UGameplayStatics::LoadGameFromMemory(SaveBytes));
+    if (!LegacySave || LegacySave->SaveVersion != static_cast<int32>(EYCRSaveVersion::LegacyTagged))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Save file is neither a binary profile nor a version 1 save game"));
+        return false;
+    }
+
+    OutProfile.Progress = LegacySave->SavedProgress;
+    OutProfile.JournalSequence = LegacySave->JournalSequence;
+    OutProfile.LastSaveTime = LegacySave->LastSaveTime;
+    return true;
+}
+
+bool FYCRSaveSchema::ReadCompactBinary(FArchive& Ar, FYCRSaveProfile& OutProfile)
+{
+    using namespace YCRSaveSchema;
+
+    FPlayerProgressData& Progress = OutProfile.Progress;
+    const UEnum* ClassEnum = StaticEnum<EYCRCharacterClasses>();
+
+    int64 SaveTicks = 0;
+    Ar << OutProfile.JournalSequence;
+    Ar << SaveTicks;
+    OutProfile.LastSaveTime = FDateTime(SaveTicks);
+
+    Progress.HighestMapUnlocked = ReadPacked(Ar);
+    Progress.HighestLevelReached = ReadPacked(Ar);
+    Progress.TotalEssence = ReadPacked(Ar);
+    Progress.TotalRunsPlayed = ReadPacked(Ar);
+    Progress.TotalRunsWon = ReadPacked(Ar);
+    Progress.TotalMonstersKilled = ReadPacked(Ar);
+    Progress.TotalElitesKilled = ReadPacked(Ar);
+    Progress.TotalBossesKilled = ReadPacked(Ar);
+    Progress.TotalGoldCollected = ReadPacked(Ar);
+
+    // The saved set is authoritative, drop the constructor default
+    Progress.UnlockedCharacters.Reset();
+
+    uint64 ClassBits = 0;
+    Ar << ClassBits;
+    for (int32 ClassValue = 0; ClassValue < 64; ClassValue++)
+    {
+        if (ClassBits & (1ull << ClassValue))
+        {
+            uint8 AdvancementLevel = 0;
+            Ar << AdvancementLevel;
+            if (ClassValue < static_cast<int32>(EYCRCharacterClasses::MAX))
+            {
+                Progress.UnlockedCharacters.Add(FName(*ClassEnum->GetNameStringByValue(ClassValue)), AdvancementLevel);
+            }
+        }
+    }
+    const int32 UnknownCharacterCount = ReadPacked(Ar);
+    for (int32 Index = 0; Index < UnknownCharacterCount && !Ar.IsError(); Index++)
+    {
+        const FName CharacterName = ReadName(Ar);
+        Progress.UnlockedCharacters.Add(CharacterName, ReadPacked(Ar));
+    }
+
+    uint64 AchievementBits = 0;
+    Ar << AchievementBits;
+    for (int32 AchievementID = 1; AchievementID < 64; AchievementID++)
+    {
+        if (AchievementBits & (1ull << AchievementID))
+        {
+            const FString& AchievementName = GetAchievementName(AchievementID);
+            if (!AchievementName.IsEmpty())
+            {
+                Progress.UnlockedAchievements.Add(AchievementName);
+            }
+        }
+    }
+    const int32 UnknownAchievementCount = ReadPacked(Ar);
+    for (int32 Index = 0; Index < UnknownAchievementCount && !Ar.IsError(); Index++)
+    {
+        FString Achievement;
+        Ar << Achievement;
+        Progress.UnlockedAchievements.Add(MoveTemp(Achievement));
+    }
+
+    const int32 CardCount = ReadPacked(Ar);
+    Progress.CollectedCards.Reserve(CardCount);
+    for (int32 Index = 0; Index < CardCount && !Ar.IsError(); Index++)
+    {
+        const FName CardName = ReadName(Ar);
+        Progress.CollectedCards.Add(CardName, ReadPacked(Ar));
+    }
+
+    return !Ar.IsError();
+}
+
+void FYCRSaveSchema::MigrateLegacyTaggedToCompactBinary(FYCRSaveProfile& Profile)
+{
+    // v1 relied on the FPlayerProgressData constructor for the starter class, v2 stores it explicitly
+    Profile.Progress.UnlockedCharacters.FindOrAdd(TEXT("Swordsman"), 1);
+    Profile.Progress.HighestMapUnlocked = FMath::Max(Profile.Progress.HighestMapUnlocked, 1);
+    Profile.Progress.HighestLevelReached = FMath::Max(Profile.Progress.HighestLevelReached, 1);
+}
+
+// =====================================================
+// Benchmark
+// =====================================================
+
+#if !UE_BUILD_SHIPPING
+namespace YCRSaveSchema
+{
+    void RunBenchmark()
+    {
+        constexpr int32 Iterations = 200;
+
+        // Everything unlocked, large card collection
+        FYCRSaveProfile Profile;
+        FPlayerProgressData& Progress = Profile.Progress;
+        const UEnum* ClassEnum = StaticEnum<EYCRCharacterClasses>();
+        for (int32 ClassValue = 1; ClassValue < static_cast<int32>(EYCRCharacterClasses::MAX); ClassValue++)
+        {
+            Progress.UnlockedCharacters.Add(FName(*ClassEnum->GetNameStringByValue(ClassValue)), 3);
+        }
+        for (int32 AchievementID = 1; AchievementID < GetAchievementNames().Num(); AchievementID++)
+        {
+            Progress.UnlockedAchievements.Add(GetAchievementName(AchievementID));
+        }
+        for (int32 CardIndex = 0; CardIndex < 500; CardIndex++)
+        {
+            Progress.CollectedCards.Add(FName(*FString::Printf(TEXT("Card_%03d"), CardIndex)), 99);
+        }
+        Progress.HighestMapUnlocked = 20;
+        Progress.HighestLevelReached = 100;
+        Progress.TotalEssence = 9999999;
+        Progress.TotalRunsPlayed = 5000;
+        Progress.TotalRunsWon = 2500;
+        Progress.TotalMonstersKilled = 10000000;
+        Progress.TotalElitesKilled = 500000;
+        Progress.TotalBossesKilled = 5000;
+        Progress.TotalGoldCollected = 50000000;
+        Profile.LastSaveTime = FDateTime::Now();
+
+        // Compact binary
+        TArray<uint8> CompactBytes;
+        FYCRSaveSchema::Write(Profile, CompactBytes);
+
+        FYCRSaveProfile Decoded;
+        const double CompactStart = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+        {
+            FYCRSaveSchema::Read(CompactBytes, Decoded);
+        }
+        const double CompactMs = (FPlatformTime::Seconds() - CompactStart) * 1000.0 / Iterations;
+
+        // Legacy tagged save game for comparison
+        UYCRSaveGame* LegacySave = NewObject<UYCRSaveGame>();
+        LegacySave->SavedProgress = Progress;
+        TArray<uint8> LegacyBytes;
+        UGameplayStatics::SaveGameToMemory(LegacySave, LegacyBytes);
+
+        const double LegacyStart = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+        {
+            UGameplayStatics::LoadGameFromMemory(LegacyBytes);
+        }
+        const double LegacyMs = (FPlatformTime::Seconds() - LegacyStart) * 1000.0 / Iterations;
+
+        UE_LOG(LogTemp, Display, TEXT("Save benchmark (maxed profile, %d cards, %d iterations):"),
+            Progress.CollectedCards.Num(), Iterations);
+        UE_LOG(LogTemp, Display, TEXT("  v%d compact binary: %d bytes, %.4f ms per load"),
+            static_cast<int32>(EYCRSaveVersion::Latest), CompactBytes.Num(), CompactMs);
+        UE_LOG(LogTemp, Display, TEXT("  v1 tagged properties: %d bytes, %.4f ms per load (+ migration)"),
+            LegacyBytes.Num(), LegacyMs);
+        UE_LOG(LogTemp, Display, TEXT("  Budget %.2f ms: %s"), FYCRSaveSchema::LoadBudgetMs,
+            CompactMs <= FYCRSaveSchema::LoadBudgetMs ? TEXT("OK") : TEXT("EXCEEDED"));
+    }
+}
+
+static FAutoConsoleCommand YCRSaveBenchmarkCommand(
+    TEXT("YCR.Save.Benchmark"),
+    TEXT("Encode and decode a maxed-out profile, log file size and load time per save version"),
+    FConsoleCommandDelegate::CreateStatic(&YCRSaveSchema::RunBenchmark));
+#endif
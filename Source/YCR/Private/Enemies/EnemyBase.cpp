@@ -3,6 +3,11 @@
 #include "GAS/YCRAbilitySystemComponent.h"
 #include "GAS/YCRAttributeSet.h"
 #include "Character/CharacterPlayer.h"
+#include "Core/GameInstanceYCR.h"
+#include "Core/InGameMode.h"
+#include "Components/YCRRunTelemetry.h"
+#include "Data/YCRLevelCurves.h"
+#include "Core/YCRHordeScalability.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameplayEffectExtension.h"
 
@@ -41,9 +46,9 @@ void AEnemyBase::InitializeAttributes()
         return;
 
     // Calculate stats based on level
-    float HealthValue = CalculateStatForLevel(BaseStats.BaseHealth, 1.15f);
-    float AttackValue = CalculateStatForLevel(BaseStats.BaseAttackPower, 1.08f);
-    float DefenseValue = CalculateStatForLevel(BaseStats.BaseDefense, 1.05f);
+    float HealthValue = CalculateStatForLevel(BaseStats.BaseHealth, EYCRLevelCurve::MonsterHealth);
+    float AttackValue = CalculateStatForLevel(BaseStats.BaseAttackPower, EYCRLevelCurve::MonsterAttack);
+    float DefenseValue = CalculateStatForLevel(BaseStats.BaseDefense, EYCRLevelCurve::MonsterDefense);
     float SpeedValue = BaseStats.BaseMoveSpeed; // Speed doesn't scale with level
 
     // Apply base stats through GAS
@@ -109,9 +114,15 @@ void AEnemyBase::InitializeMonsterStats()
     // Set base stats based on monster type
     // This could be expanded with a data table lookup
 
+    if (MonsterLevel > FYCRLevelCurves::MaxLevel)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("%s: MonsterLevel %d is above the level curve cap, scaling as level %d"),
+            *GetName(), MonsterLevel, FYCRLevelCurves::MaxLevel);
+    }
+
     // Apply level scaling
-    float HealthMultiplier = CalculateStatForLevel(1.0f, 1.15f);
-    float AttackMultiplier = CalculateStatForLevel(1.0f, 1.08f);
+    float HealthMultiplier = FYCRLevelCurves::GetScale(EYCRLevelCurve::MonsterHealth, MonsterLevel);
+    float AttackMultiplier = FYCRLevelCurves::GetScale(EYCRLevelCurve::MonsterAttack, MonsterLevel);
 
     // Set movement component properties
     if (GetCharacterMovement())
@@ -120,24 +131,24 @@ void AEnemyBase::InitializeMonsterStats()
     }
 }
 
-float AEnemyBase::CalculateStatForLevel(float BaseStat, float GrowthRate) const
+float AEnemyBase::CalculateStatForLevel(float BaseStat, EYCRLevelCurve Curve) const
 {
-    // Exponential growth formula similar to RO
-    return BaseStat * FMath::Pow(GrowthRate, MonsterLevel - 1);
+    // Exponential growth formula similar to RO, baked per level
+    return BaseStat * FYCRLevelCurves::GetScale(Curve, MonsterLevel);
 }
 
 int32 AEnemyBase::CalculateExperienceReward() const
 {
     // Base experience * level modifier
-    float LevelModifier = 1.0f + (MonsterLevel * 0.1f);
+    float LevelModifier = FYCRLevelCurves::GetScale(EYCRLevelCurve::MonsterExperience, MonsterLevel);
     return FMath::RoundToInt(BaseStats.BaseExperience * LevelModifier);
 }
 
 int32 AEnemyBase::CalculateGoldReward() const
 {
     // Base gold with some randomness
-    float RandomModifier = FMath::RandRange(0.8f, 1.2f);
-    float LevelModifier = 1.0f + (MonsterLevel * 0.15f);
+    float RandomModifier = UGameInstanceYCR::GetRandomStream(this, EYCRRandomStream::GoldVariance).FRandRange(0.8f, 1.2f);
+    float LevelModifier = FYCRLevelCurves::GetScale(EYCRLevelCurve::MonsterGold, MonsterLevel);
     return FMath::RoundToInt(BaseStats.BaseGold * LevelModifier * RandomModifier);
 }
 
@@ -162,8 +173,8 @@ void AEnemyBase::HandleDeath()
         UE_LOG(LogTemp, Log, TEXT("Monster died: Granting %d EXP and %d Gold"), ExpReward, GoldReward);
     }
 
-    // Destroy after delay
-    SetLifeSpan(2.0f);
+    // Destroy after delay (shorter on low horde quality)
+    SetLifeSpan(FYCRHordeScalability::GetCorpseLifetime());
 }
 
 float AEnemyBase::GetElementalDamageModifier(EYCRElementType IncomingDamageElement) const
@@ -185,6 +196,14 @@ void AEnemyBase::OnHealthChanged(float OldValue, float NewValue)
         // Monster took damage - could trigger special behaviors
         float DamageTaken = OldValue - NewValue;
         
+        if (AInGameMode* GameMode = GetWorld()->GetAuthGameMode<AInGameMode>())
+        {
+            if (UYCRRunTelemetry* Telemetry = GameMode->GetRunTelemetry())
+            {
+                Telemetry->RecordDamage(DamageTaken);
+            }
+        }
+        
         // Check for assist behavior
         if (bIsAssistive)
         {
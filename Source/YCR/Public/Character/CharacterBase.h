@@ -4,6 +4,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
 #include "AbilitySystemInterface.h"
+#include "GameplayEffectTypes.h"
 #include "CharacterBase.generated.h"
 
 // Forward Declarations
@@ -83,6 +84,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "YCR|Stats")
     virtual void SetCharacterLevel(int32 NewLevel);
 
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|Stats")
+    int32 GetCharacterLevel() const { return CharacterLevel; }
+
     /** Get health as percentage (0-1) */
     UFUNCTION(BlueprintCallable, Category = "YCR|Stats")
     float GetHealthPercent() const;
@@ -107,7 +111,7 @@ protected:
     /** Grant initial abilities */
     virtual void GrantDefaultAbilities();
 
-    /** Apply initial effects */
+    /** Apply passive and level effects for the current level, replacing the previously applied ones */
     virtual void ApplyDefaultEffects();
 
     /** Called when health changes */
@@ -118,4 +122,8 @@ protected:
 
     /** Handle death */
     virtual void Die();
+
+private:
+    /** Effects applied by ApplyDefaultEffects, removed before the next evaluation so they never stack */
+    TArray<FActiveGameplayEffectHandle> DefaultEffectHandles;
 };
\ No newline at end of file
@@ -14,6 +14,7 @@ class UInputMappingContext;
 class UInputAction;
 class UYCREnemyAIComponent;
 struct FInputActionValue;
+struct FYCRRunCheckpoint;
 
 /**
  * Player character class for YCR
@@ -83,6 +84,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "YCR|Stats", meta = (ClampMin = "100.0", ClampMax = "1000.0"))
     float PickupRadius;
 
+    /** Range for interacting with chests, shrines and vendors (also drives the prompt focus) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Stats", meta = (ClampMin = "50.0"))
+    float InteractionRadius;
+
     /** Gold collected in current run */
     UPROPERTY(BlueprintReadOnly, Category = "YCR|Currency")
     int32 CurrentGold;
@@ -109,13 +114,13 @@ private:
     // Gameplay Functions
     // =====================================================
     
-    /** Handle collecting experience */
+    /** Handle collecting experience, applying every level it is enough for in one step */
     void CollectExperience(float Amount);
 
-    /** Level up the character */
-    void LevelUp();
+    /** Jump straight to NewLevel, re-evaluating level effects once */
+    void LevelUp(int32 NewLevel);
 
-    /** Check for nearby interactables */
+    /** Interact with the closest interactable in range */
     void CheckForInteractables();
 
     /** Collect items in pickup radius */
@@ -146,14 +151,35 @@ public:
     UFUNCTION(BlueprintCallable, Category = "YCR|Stats")
     float GetPickupRadius() const { return PickupRadius; }
 
-    /** Called when player levels up - Blueprint implementable */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Stats")
+    float GetInteractionRadius() const { return InteractionRadius; }
+
+    /** Called once per experience gain that levels up, with how many levels were gained - Blueprint implementable */
     UFUNCTION(BlueprintImplementableEvent, Category = "YCR|Experience")
-    void OnLevelUp();
+    void OnLevelUp(int32 NewLevel, int32 LevelsGained);
 
     /** Called when player collects item - Blueprint implementable */
     UFUNCTION(BlueprintImplementableEvent, Category = "YCR|Pickup")
     void OnItemCollected(const FName& ItemName, int32 Quantity);
 
+    /** Store level, experience, gold, attributes and granted abilities */
+    void WriteCheckpoint(FYCRRunCheckpoint& Checkpoint) const;
+
+    /** Restore state written by WriteCheckpoint */
+    void RestoreFromCheckpoint(const FYCRRunCheckpoint& Checkpoint);
+
+    // =====================================================
+    // Scripted Input (benchmark bot, tests)
+    // =====================================================
+
+    /** Same movement the Move action applies; X is right, Y is forward relative to the control yaw */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Input")
+    void ApplyMoveInput(FVector2D MovementVector);
+
+    /** Same interaction the Interact action triggers */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Input")
+    void TryInteract() { CheckForInteractables(); }
+
 protected:
     // =====================================================
     // Overrides from CharacterBase
@@ -42,7 +42,13 @@ private:
 	UPROPERTY()
 	TArray<FStatusEffect> ActiveEffects;
     
+	/** MaxWalkSpeed before the first active slow, negative while nothing slows */
+	float BaseWalkSpeed = -1.0f;
+    
 	void ProcessStatusEffects(float DeltaTime);
+    
+	/** Set MaxWalkSpeed from the base speed and the active slows */
+	void UpdateSlow();
 
 public:
 	UFUNCTION(BlueprintCallable, Category = "YCR|StatusEffects")
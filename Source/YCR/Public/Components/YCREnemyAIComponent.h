@@ -12,6 +12,10 @@ class YCR_API UYCREnemyAIComponent : public UActorComponent
 public:	
 	UYCREnemyAIComponent();
 
+	/** Enemies farther than this from the player think at LodTickInterval instead of every frame */
+	static void SetLodDistance(float Distance) { LodDistanceSquared = FMath::Square(Distance); }
+	static float GetLodDistance() { return FMath::Sqrt(LodDistanceSquared); }
+
 protected:
 	// Component lifecycle
 	virtual void BeginPlay() override;
@@ -27,7 +31,14 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI")
 	float ContactDamage = 10.0f;
 
+	/** Tick interval beyond the LOD distance (movement uses the real delta, so speed is unchanged) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "AI|LOD", meta = (ClampMin = "0.0"))
+	float LodTickInterval = 0.2f;
+
 private:
+	/** Shared by all enemies, set by UYCREnemyBudgetController */
+	static float LodDistanceSquared;
+
 	UPROPERTY()
 	class ACharacterBase* OwnerCharacter;
 
@@ -39,4 +50,5 @@ private:
 	void CheckAttackRange();
 	void FindTargetPlayer();
 	void ApplyContactDamage();
+	void UpdateLod();
 };
\ No newline at end of file
@@ -0,0 +1,126 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "YCREnemyBudgetController.generated.h"
+
+class AEnemyBase;
+struct FSpawnWaveData;
+
+/**
+ * Holds a game thread frame time target by scaling how much horde the machine has to simulate.
+ * A single budget value in [0, 1] is steered towards the target and mapped onto the live enemy cap,
+ * the spawn rate multiplier and the AI LOD distance, each within designer-set bounds
+ * further limited by the horde quality level (FYCRHordeScalability).
+ * When fewer enemies than the reference count are allowed, the ones that do spawn get more health
+ * and damage so the pressure on the player stays roughly the same.
+ * Stays inactive for simulated (-YCRSimulate) and bot (-YCRBot) runs: wall clock frame times would
+ * make them diverge between replays.
+ * Lives on AInGameMode.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class YCR_API UYCREnemyBudgetController : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UYCREnemyBudgetController();
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+    void BeginRun(int32 InReferenceEnemyCount);
+    void EndRun();
+
+    /** True while a run is steered, the outputs below are neutral otherwise */
+    UFUNCTION(BlueprintPure, Category = "YCR|Budget")
+    bool IsActive() const { return bActive; }
+
+    // =====================================================
+    // Outputs (read by spawning)
+    // =====================================================
+
+    UFUNCTION(BlueprintPure, Category = "YCR|Budget")
+    int32 GetEnemyCap() const { return EnemyCap; }
+
+    UFUNCTION(BlueprintPure, Category = "YCR|Budget")
+    float GetSpawnRateMultiplier() const { return SpawnRateMultiplier; }
+
+    /** Health and damage scale for spawned enemies, 1 at the reference enemy count */
+    UFUNCTION(BlueprintPure, Category = "YCR|Budget")
+    float GetDifficultyCompensation() const { return DifficultyCompensation; }
+
+    UFUNCTION(BlueprintPure, Category = "YCR|Budget")
+    float GetBudget() const { return Budget; }
+
+    UFUNCTION(BlueprintPure, Category = "YCR|Budget")
+    float GetSmoothedGameThreadMs() const { return SmoothedFrameMs; }
+
+    /** Apply the wave's health/damage multipliers, compensated for the current cap, to a freshly spawned enemy */
+    void ApplyWaveScaling(AEnemyBase* Enemy, const FSpawnWaveData& Wave) const;
+
+protected:
+    // =====================================================
+    // Configuration
+    // =====================================================
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget")
+    bool bEnabled = true;
+
+    /** Game thread time to hold (16.6 = 60 fps) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget", meta = (ClampMin = "1.0"))
+    float TargetFrameMs = 16.6f;
+
+    /** No change while the smoothed frame time is within this fraction of the target */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget", meta = (ClampMin = "0.0", ClampMax = "0.5"))
+    float DeadZone = 0.1f;
+
+    /** Budget change per second at 100% frame time error */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget", meta = (ClampMin = "0.01"))
+    float Gain = 0.25f;
+
+    /** Smoothing window of the measured frame time in seconds */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget", meta = (ClampMin = "0.05"))
+    float SmoothingTime = 0.5f;
+
+    /** Budget the run starts at */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+    float InitialBudget = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget|Bounds", meta = (ClampMin = "1"))
+    int32 MinEnemyCap = 40;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget|Bounds", meta = (ClampMin = "1"))
+    int32 MaxEnemyCap = 300;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget|Bounds", meta = (ClampMin = "0.1"))
+    float MinSpawnRateMultiplier = 0.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget|Bounds", meta = (ClampMin = "0.1"))
+    float MaxSpawnRateMultiplier = 1.5f;
+
+    /** Enemies closer than this to the player run their AI every frame */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget|Bounds", meta = (ClampMin = "0.0"))
+    float MinAILodDistance = 1000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget|Bounds", meta = (ClampMin = "0.0"))
+    float MaxAILodDistance = 4000.0f;
+
+    /** Limits of the health/damage compensation */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget|Bounds", meta = (ClampMin = "0.1"))
+    float MinDifficultyCompensation = 0.75f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Budget|Bounds", meta = (ClampMin = "1.0"))
+    float MaxDifficultyCompensation = 2.5f;
+
+private:
+    bool bActive = false;
+    float Budget = 0.5f;
+    float SmoothedFrameMs = 0.0f;
+    int32 ReferenceEnemyCount = 100;
+
+    int32 EnemyCap = 100;
+    float SpawnRateMultiplier = 1.0f;
+    float DifficultyCompensation = 1.0f;
+
+    void ApplyBudget();
+};
@@ -4,11 +4,17 @@
 #include "Components/ActorComponent.h"
 #include "Enums/EYCRLootTypes.h"
 #include "Enums/EYCRMonsterTypes.h"
+#include "Data/YCRLootTable.h"
 #include "YCRLootComponent.generated.h"
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnExpGemDropped, const FYCRExpGemData&, GemData);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCoinDropped, int32, CoinValue);
+class UYCRLootTable;
+class UYCRRewardAggregator;
+class UYCRGameplayEventBus;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnExperienceDropped, int32, ExperienceValue);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGemDropped, EYCRGemColor, GemColor, const FVector&, DropLocation);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBuffScrollDropped, const FYCRBuffScrollData&, BuffData);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnRareItemDropped, FName, ItemID, const FVector&, DropLocation);
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class YCR_API UYCRLootComponent : public UActorComponent
@@ -26,53 +32,74 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loot")
     EYCRMonsterType MonsterType = EYCRMonsterType::Normal;
 
-    // Base values for this monster
+    // Loot table to roll from. Falls back to the current map's table, then the default balance table.
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loot")
-    int32 BaseExpValue = 1;
+    UYCRLootTable* LootTable;
 
+    // Fire the per-drop events below even when a reward aggregator collects the drops.
+    // Leave off for regular enemies - the aggregator emits one summary per frame.
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loot")
-    int32 BaseCoinValue = 1;
+    bool bBroadcastIndividualDrops = false;
 
-    // Drop chances
+    // Buff scroll roll on top of the table: chance for one scroll, picked evenly from AvailableBuffScrolls
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loot", meta = (ClampMin = "0.0", ClampMax = "100.0"))
     float BuffScrollDropChance = 5.0f; // 5% chance
 
-    // Available buff scrolls this monster can drop
+    // Available buff scrolls this monster can drop, none = no buff scroll roll
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Loot")
     TArray<EYCRBuffType> AvailableBuffScrolls;
 
-    // Events
+    // Events (exp gem and coin drops are posted to UYCRGameplayEventBus)
     UPROPERTY(BlueprintAssignable, Category = "Loot")
-    FOnExpGemDropped OnExpGemDropped;
+    FOnExperienceDropped OnExperienceDropped;
 
     UPROPERTY(BlueprintAssignable, Category = "Loot")
-    FOnCoinDropped OnCoinDropped;
+    FOnGemDropped OnGemDropped;
 
     UPROPERTY(BlueprintAssignable, Category = "Loot")
     FOnBuffScrollDropped OnBuffScrollDropped;
 
+    UPROPERTY(BlueprintAssignable, Category = "Loot")
+    FOnRareItemDropped OnRareItemDropped;
+
     // Main drop function
     UFUNCTION(BlueprintCallable, Category = "Loot")
-    void DropLoot(const FVector& DropLocation);
+    void GenerateLoot(const FVector& DropLocation, EYCRMonsterType InMonsterType, int32 MonsterLevel);
 
     // Get calculated values
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Loot")
-    int32 GetCalculatedExpValue() const;
+    float GetExpMultiplierForType(EYCRMonsterType InMonsterType) const;
 
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Loot")
-    int32 GetCalculatedCoinValue() const;
+    float GetGemDropChanceForType(EYCRMonsterType InMonsterType) const;
 
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Loot")
-    float GetOutGameGemDropChance() const;
+    EYCRGemColor GetGemColorForType(EYCRMonsterType InMonsterType) const;
 
-    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Loot")
-    EYCRGemColor GetGemColorForRank() const;
+    /** Loot table used for rolls (assigned table, current map's table or default balance) */
+    const UYCRLootTable* GetLootTable() const;
+
+    /** Hand out one rolled drop (called directly or by the reward aggregator's batched roll) */
+    void HandleLootDrop(const FYCRLootDrop& Drop, const FVector& DropLocation);
 
 private:
-    void DropExpGems(const FVector& Location);
-    void DropCoins(const FVector& Location);
-    void DropBuffScroll(const FVector& Location);
+    void DropCoins(const FVector& DropLocation, int32 CoinAmount);
+    void RollBuffScroll(const FVector& DropLocation);
+
+    /** Loot table of the map being played, from the map data's InRun bundle */
+    UYCRLootTable* FindMapLootTable() const;
+
+    /** Reused roll output when no aggregator batches the rolls */
+    TArray<FYCRLootDrop> DropBuffer;
+
+    /** Aggregator of the running game mode, resolved on BeginPlay */
+    UPROPERTY()
+    UYCRRewardAggregator* RewardAggregator;
+
+    UPROPERTY()
+    UYCRGameplayEventBus* EventBus;
 
-    float GetExpMultiplierForRank() const;
-    float GetCoinMultiplierForRank() const;
+    /** Resolved on BeginPlay */
+    UPROPERTY()
+    UYCRLootTable* MapLootTable;
 };
\ No newline at end of file
@@ -0,0 +1,99 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "YCRPrewarmScheduler.generated.h"
+
+struct FStreamableHandle;
+
+/**
+ * Streams wave and boss classes in ahead of the run time they are needed at and
+ * releases them once their wave is over, so neither a late wave nor the boss
+ * loads synchronously on arrival.
+ * The timeline comes from the level's spawn wave table and the game mode's boss config.
+ * Driven once per second by AInGameMode. Lives on AInGameMode.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class YCR_API UYCRPrewarmScheduler : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UYCRPrewarmScheduler();
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    /** Build the timeline and request everything already due at RunTime (resumed runs start late) */
+    void BeginRun(float RunTime);
+
+    void Update(float RunTime);
+
+    /** Release every handle and stop pool prewarming */
+    void EndRun();
+
+protected:
+    /** How far ahead of a wave or the boss its classes start loading */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Prewarm", meta = (ClampMin = "0.0"))
+    float LeadTime = 30.0f;
+
+    /** Classes stay loaded this long after their wave ended (stragglers still alive) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Prewarm", meta = (ClampMin = "0.0"))
+    float UnloadGraceTime = 30.0f;
+
+    /**
+     * Also spawn deactivated boss instances into the actor pool once the boss class is loaded.
+     * Wave classes are only streamed: wave spawns do not go through the pool yet, prewarmed
+     * wave enemies would cost memory and BeginPlay time and never be used.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Prewarm")
+    bool bPrewarmPool = true;
+
+    /** AInGameMode::SpawnBoss acquires the boss from the pool */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Prewarm", meta = (ClampMin = "0", EditCondition = "bPrewarmPool"))
+    int32 PoolSizeBoss = 1;
+
+    /** Pool instances spawned per frame, keeps prewarming itself from hitching */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Prewarm", meta = (ClampMin = "1", EditCondition = "bPrewarmPool"))
+    int32 PoolSpawnsPerFrame = 2;
+
+private:
+    struct FPrewarmEvent
+    {
+        float StartTime = 0.0f;
+
+        /** Run time after which the classes are no longer needed */
+        float EndTime = TNumericLimits<float>::Max();
+
+        TArray<FSoftObjectPath> Classes;
+
+        /** Deactivated instances per class to keep in the pool, 0 = stream only */
+        int32 PoolSize = 0;
+        bool bBoss = false;
+
+        TSharedPtr<FStreamableHandle> Handle;
+        bool bRequested = false;
+        bool bReleased = false;
+    };
+
+    struct FPoolRequest
+    {
+        TWeakObjectPtr<UClass> Class;
+        int32 TargetFree = 0;
+    };
+
+    /** Sorted by StartTime */
+    TArray<FPrewarmEvent> Events;
+
+    TArray<FPoolRequest> PoolRequests;
+
+    /** Map data ids whose Boss bundle this scheduler added */
+    TArray<FPrimaryAssetId> BossBundleIds;
+
+    void BuildTimeline();
+    void RequestEvent(int32 EventIndex);
+    void ReleaseEvent(int32 EventIndex);
+    void OnEventLoaded(int32 EventIndex);
+    bool IsClassStillNeeded(const FSoftObjectPath& ClassPath, int32 IgnoredEventIndex) const;
+    void LoadBossBundle();
+};
@@ -0,0 +1,129 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Enums/EYCRLootTypes.h"
+#include "Enums/EYCRMonsterTypes.h"
+#include "Data/YCRLootTable.h"
+#include "YCRRewardAggregator.generated.h"
+
+/**
+ * Everything that was killed and dropped during one frame
+ */
+USTRUCT(BlueprintType)
+struct YCR_API FYCRFrameRewardSummary
+{
+    GENERATED_BODY()
+
+    /** Kill count indexed by EYCRMonsterType */
+    UPROPERTY(BlueprintReadOnly, Category = "Rewards")
+    TArray<int32> KillsPerMonsterType;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Rewards")
+    int32 TotalKills = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Rewards")
+    int32 TotalGold = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Rewards")
+    int32 TotalExperience = 0;
+
+    /** Out-game gems dropped this frame */
+    UPROPERTY(BlueprintReadOnly, Category = "Rewards")
+    TArray<EYCRGemColor> GemColors;
+
+    /** One entry per kill that dropped loot */
+    UPROPERTY(BlueprintReadOnly, Category = "Rewards")
+    TArray<FVector> DropLocations;
+
+    FYCRFrameRewardSummary()
+    {
+        KillsPerMonsterType.SetNumZeroed(static_cast<int32>(EYCRMonsterType::MAX));
+    }
+
+    int32 GetKills(EYCRMonsterType MonsterType) const
+    {
+        return KillsPerMonsterType[static_cast<int32>(MonsterType)];
+    }
+
+    bool IsEmpty() const
+    {
+        return TotalKills == 0 && TotalGold == 0 && TotalExperience == 0 && GemColors.IsEmpty();
+    }
+
+    void Reset()
+    {
+        for (int32& Kills : KillsPerMonsterType)
+        {
+            Kills = 0;
+        }
+        TotalKills = 0;
+        TotalGold = 0;
+        TotalExperience = 0;
+        GemColors.Reset();
+        DropLocations.Reset();
+    }
+};
+
+class UYCRLootComponent;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRewardsAggregated, const FYCRFrameRewardSummary&, Summary);
+
+/**
+ * Collects kills and loot drops over a frame and emits a single summary
+ * at the end of the frame instead of one delegate broadcast per drop.
+ * Lives on AInGameMode.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class YCR_API UYCRRewardAggregator : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UYCRRewardAggregator();
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+    // =====================================================
+    // Recording (called by loot components / game mode)
+    // =====================================================
+
+    void RecordKill(EYCRMonsterType MonsterType);
+    void RecordExperience(int32 Amount);
+    void RecordGold(int32 Amount, const FVector& DropLocation);
+    void RecordGem(EYCRGemColor GemColor, const FVector& DropLocation);
+
+    /** Roll the kill's loot with the rest of the frame's kills (one RollLootBatch per table) */
+    void QueueLootRoll(UYCRLootComponent* Source, const FYCRLootRollRequest& Request, const FVector& DropLocation);
+
+    /** Emit the pending summary immediately (e.g. before the run ends) */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Rewards")
+    void Flush();
+
+    /** Called once per frame with everything collected during that frame */
+    UPROPERTY(BlueprintAssignable, Category = "YCR|Events")
+    FOnRewardsAggregated OnRewardsAggregated;
+
+private:
+    /** Summary being filled during the current frame */
+    FYCRFrameRewardSummary Pending;
+
+    struct FPendingLootRoll
+    {
+        TWeakObjectPtr<UYCRLootComponent> Source;
+        const UYCRLootTable* Table = nullptr;
+        FYCRLootRollRequest Request;
+        FVector DropLocation = FVector::ZeroVector;
+    };
+
+    /** Kills of the current frame waiting for their loot roll */
+    TArray<FPendingLootRoll> PendingLootRolls;
+
+    /** Buffers reused by every batched roll */
+    TArray<FYCRLootRollRequest> BatchRequests;
+    TArray<int32> BatchRollIndices;
+    TArray<FYCRLootDrop> BatchDrops;
+
+    void AddDropLocation(const FVector& DropLocation);
+    void RollPendingLoot();
+};
@@ -0,0 +1,76 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Core/YCRRunCheckpoint.h"
+#include "YCRRunCheckpointComponent.generated.h"
+
+/**
+ * Periodically snapshots the running game into a compact checkpoint and
+ * rebuilds the world from one when a run is continued.
+ * Capture runs on the game thread, compression and the disk write do not.
+ * Restore spawns enemies and gems over several frames within a time budget.
+ * Lives on AInGameMode.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class YCR_API UYCRRunCheckpointComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UYCRRunCheckpointComponent();
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    // =====================================================
+    // Capture
+    // =====================================================
+
+    /** Write a checkpoint every CheckpointInterval seconds */
+    void StartCheckpointing();
+    void StopCheckpointing();
+
+    /** Capture and write a checkpoint now */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Checkpoint")
+    void WriteCheckpoint(bool bWaitForWrite = false);
+
+    // =====================================================
+    // Restore
+    // =====================================================
+
+    /** Restore the player right away and queue enemies and gems */
+    void BeginRestore(FYCRRunCheckpoint&& Checkpoint);
+
+    UFUNCTION(BlueprintPure, Category = "YCR|Checkpoint")
+    bool IsRestoring() const { return bRestoring; }
+
+protected:
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Checkpoint", meta = (ClampMin = "1.0"))
+    float CheckpointInterval = 15.0f;
+
+    /** Game thread time restore may spend per frame */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Checkpoint", meta = (ClampMin = "0.1"))
+    float RestoreFrameBudgetMs = 2.0f;
+
+private:
+    FTimerHandle CheckpointTimerHandle;
+
+    /** Checkpoint being restored */
+    FYCRRunCheckpoint RestoreData;
+
+    /** Classes of RestoreData.ClassTable, resolved on first use */
+    TArray<TOptional<UClass*>> ResolvedClasses;
+
+    int32 NextEnemyIndex = 0;
+    int32 NextGemIndex = 0;
+    bool bRestoring = false;
+
+    void CaptureCheckpoint(FYCRRunCheckpoint& OutCheckpoint) const;
+    UClass* ResolveClass(uint16 ClassIndex);
+    void RestoreEnemy(const FYCRCheckpointEnemy& Enemy);
+    void RestoreGem(const FYCRCheckpointGem& Gem);
+    void FinishRestore();
+
+    void OnCheckpointTimer() { WriteCheckpoint(false); }
+};
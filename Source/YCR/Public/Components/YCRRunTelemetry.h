@@ -0,0 +1,131 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Async/Future.h"
+#include "YCRRunTelemetry.generated.h"
+
+/**
+ * One second of run telemetry
+ */
+USTRUCT(BlueprintType)
+struct YCR_API FYCRTelemetrySample
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float RunTime = 0.0f;
+
+    /** Average and worst frame time over the second */
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float AvgFrameMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float MaxFrameMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float GameThreadMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    int32 AliveEnemies = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    int32 Projectiles = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    int32 Gems = 0;
+
+    /** Kills and damage dealt during this second */
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    int32 Kills = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float Damage = 0.0f;
+
+    /** Enemies the spawner wanted but could not place yet */
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    int32 SpawnBacklog = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float UsedMemoryMB = 0.0f;
+};
+
+/**
+ * Records one sample per second of run time into a fixed-size ring buffer
+ * and writes the run to Saved/Telemetry as CSV and JSON when it ends.
+ * The buffer is allocated when the run starts, so recording never allocates.
+ * Lives on AInGameMode.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class YCR_API UYCRRunTelemetry : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UYCRRunTelemetry();
+
+    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+    // =====================================================
+    // Run Lifecycle
+    // =====================================================
+
+    void BeginRun();
+
+    /** Stop recording and export the buffer */
+    void EndRun(bool bVictory);
+
+    /** Close the current second (called once per second by the game mode) */
+    void RecordSample(float RunTime);
+
+    // =====================================================
+    // Counters (accumulated into the current second)
+    // =====================================================
+
+    void RecordKill() { PendingKills++; }
+    void RecordDamage(float Amount) { PendingDamage += Amount; }
+    void SetSpawnBacklog(int32 Backlog) { SpawnBacklog = Backlog; }
+
+    UFUNCTION(BlueprintPure, Category = "YCR|Telemetry")
+    int32 GetNumSamples() const { return NumSamples; }
+
+    /** Samples oldest first */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Telemetry")
+    void GetSamples(TArray<FYCRTelemetrySample>& OutSamples) const;
+
+protected:
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Telemetry")
+    bool bEnabled = true;
+
+    /** Samples kept; older seconds are overwritten (20 minutes by default) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Telemetry", meta = (ClampMin = "60"))
+    int32 Capacity = 1200;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Telemetry")
+    bool bExportCsv = true;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "YCR|Telemetry")
+    bool bExportJson = true;
+
+private:
+    TArray<FYCRTelemetrySample> Samples;
+    int32 NextSampleIndex = 0;
+    int32 NumSamples = 0;
+    bool bRecording = false;
+
+    // Frame time accumulated since the last sample
+    double FrameTimeSum = 0.0;
+    float FrameTimeMax = 0.0f;
+    int32 FrameCount = 0;
+
+    int32 PendingKills = 0;
+    float PendingDamage = 0.0f;
+    int32 SpawnBacklog = 0;
+
+    /** File write of the last export, finished before the component goes away */
+    TFuture<void> PendingExport;
+
+    void CountActors(FYCRTelemetrySample& Sample) const;
+    void Export(bool bVictory);
+};
@@ -6,15 +6,18 @@
 #include "Engine/GameInstance.h"
 #include "Engine/DataTable.h"
 #include "Data/YCRSaveGameData.h"
+#include "Enums/EYCRRandomStream.h"
+#include "Core/YCRProgressJournal.h"
+#include "Core/YCRAchievementTracker.h"
+#include "Core/YCRRunCheckpoint.h"
+#include "Async/Future.h"
 #include "GameInstanceYCR.generated.h"
 
 // Forward declarations
 class UYCRSaveGame;
-
-
-
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCurrencyChanged, int32, NewAmount);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAchievementUnlocked, const FString&, AchievementID);
+class UYCRAchievementSet;
+struct FStreamableHandle;
+enum class EYCRCurrency : uint8;
 
 /**
  * Main Game Instance for YCR
@@ -33,9 +36,19 @@ public:
     virtual void Shutdown() override;
     
     // Save/Load functionality
+    
+    /** Write progress now (asynchronously), skipping the debounce window */
     UFUNCTION(BlueprintCallable, Category = "Save Game")
     void SaveGameData();
     
+    /** Mark progress dirty; changes within SaveDebounceSeconds are written together */
+    UFUNCTION(BlueprintCallable, Category = "Save Game")
+    void RequestSave();
+    
+    /** Fold the journal into a fresh snapshot and block until every save on disk is complete */
+    UFUNCTION(BlueprintCallable, Category = "Save Game")
+    void FlushSaveGame();
+    
     UFUNCTION(BlueprintCallable, Category = "Save Game")
     void LoadGameData();
     
@@ -46,38 +59,124 @@ public:
     void ResetProgress();
     
     // Current Run Management
+    
+    /**
+     * Start a new run
+     * @param SelectedCharacterClass - Character to play
+     * @param bUseSeed - Use Seed as given; otherwise the seed from SetNextRunSeed, -YCRSeed= or a random one
+     * @param Seed - Run seed, any value (0 included) when bUseSeed is set
+     */
+    UFUNCTION(BlueprintCallable, Category = "Run")
+    void StartNewRun(const FString& SelectedCharacterClass, bool bUseSeed = false, int32 Seed = 0);
+    
+    /** Seed the next run the game mode starts (menus call this before travelling to the run map) */
     UFUNCTION(BlueprintCallable, Category = "Run")
-    void StartNewRun(const FString& CharacterClass, const TArray<int32>& SelectedCards);
+    void SetNextRunSeed(int32 Seed);
     
     UFUNCTION(BlueprintCallable, Category = "Run")
     void EndCurrentRun(bool bVictory);
     
     UFUNCTION(BlueprintPure, Category = "Run")
-    FORCEINLINE FCurrentRunData GetCurrentRunData() const { return CurrentRunData; }
+    const FCurrentRunData& GetCurrentRunData() const;
+    
+    UFUNCTION(BlueprintPure, Category = "Run")
+    int32 GetRunSeed() const { return CurrentRunData.RunSeed; }
+    
+    /** Seeded stream of one gameplay system for the current run */
+    FRandomStream& GetRandomStream(EYCRRandomStream Stream) { return RandomStreams[static_cast<int32>(Stream)]; }
+    
+    /** Seeded stream for the run of WorldContextObject's game instance (unseeded fallback outside YCR) */
+    static FRandomStream& GetRandomStream(const UObject* WorldContextObject, EYCRRandomStream Stream);
+    
+    /** Add the kills and rewards of one frame to the current run */
+    UFUNCTION(BlueprintCallable, Category = "Run")
+    void UpdateRunStats(int32 MonstersKilled, int32 ElitesKilled, int32 BossesKilled, int32 GoldCollected,
+        int32 ExperienceCollected = 0);
+    
+    UFUNCTION(BlueprintCallable, Category = "Run")
+    void SetSelectedCharacter(const FName& CharacterClass) { CurrentRunData.SelectedCharacter = CharacterClass; }
+    
+    UFUNCTION(BlueprintCallable, Category = "Run")
+    void SetCurrentLevel(int32 Level);
+    
+    UFUNCTION(BlueprintCallable, Category = "Run")
+    void SetRunTime(float RunTime) { CurrentRunData.RunTime = RunTime; }
+    
+    // Run Checkpoint
+    
+    /** Is there an unfinished run to continue */
+    UFUNCTION(BlueprintPure, Category = "Run")
+    bool HasRunCheckpoint() const;
+    
+    /** Read and decode the checkpoint so the next StartRun resumes it */
+    UFUNCTION(BlueprintCallable, Category = "Run")
+    bool LoadRunCheckpoint();
+    
+    /** Checkpoint loaded by LoadRunCheckpoint, null when none */
+    const FYCRRunCheckpoint* GetPendingRunCheckpoint() const { return PendingRunCheckpoint.GetPtrOrNull(); }
+    
+    /** Hand the loaded checkpoint to the game mode, false when nothing was loaded */
+    bool TakePendingRunCheckpoint(FYCRRunCheckpoint& OutCheckpoint);
+    
+    /** Restore run data, counters and random streams instead of starting a new run */
+    void ResumeRun(const FYCRRunCheckpoint& Checkpoint);
+    
+    /** Run data and random stream state of the current run */
+    void FillRunCheckpoint(FYCRRunCheckpoint& OutCheckpoint) const;
+    
+    /** Serialize on the game thread, compress and write on a background thread. Skipped while a write is in flight. */
+    void WriteRunCheckpoint(const FYCRRunCheckpoint& Checkpoint, bool bWaitForWrite = false);
+    
+    /** The run is over, nothing left to continue */
+    void DeleteRunCheckpoint();
     
     // Currency Management
     UFUNCTION(BlueprintCallable, Category = "Currency")
     void AddEssence(int32 Amount);
     
     UFUNCTION(BlueprintCallable, Category = "Currency")
-    void SpendEssence(int32 Amount);
+    bool SpendEssence(int32 Amount);
+    
+    UFUNCTION(BlueprintPure, Category = "Currency")
+    int32 GetTotalEssence() const;
     
     UFUNCTION(BlueprintPure, Category = "Currency")
     FORCEINLINE int32 GetEssence() const { return PlayerProgress.TotalEssence; }
     
+    // Map Progression
+    UFUNCTION(BlueprintCallable, Category = "Maps")
+    void UnlockMap(int32 MapLevel);
+    
+    UFUNCTION(BlueprintPure, Category = "Maps")
+    bool IsMapUnlocked(int32 MapLevel) const;
+    
+    /** Travel to a map, seamlessly through the transition map when the current game mode allows it */
+    UFUNCTION(BlueprintCallable, Category = "Maps")
+    void TransitionToMap(const FName& MapName);
+    
+    /** Start loading a map package in the background so a later TransitionToMap finds it in memory */
+    UFUNCTION(BlueprintCallable, Category = "Maps")
+    void PreloadMap(const FName& MapName);
+    
+    UFUNCTION(BlueprintPure, Category = "Maps")
+    bool IsMapPreloaded(const FName& MapName) const { return PreloadedMapName == MapName && PreloadedMapWorld != nullptr; }
+    
     // Character Unlocks
     UFUNCTION(BlueprintCallable, Category = "Characters")
-    bool IsCharacterUnlocked(const FString& CharacterName) const;
+    bool IsCharacterUnlocked(const FName& CharacterClass) const;
     
     UFUNCTION(BlueprintCallable, Category = "Characters")
-    void UnlockCharacter(const FString& CharacterName);
+    void UnlockCharacter(const FName& CharacterClass, int32 AdvancementLevel = 1);
+    
+    UFUNCTION(BlueprintPure, Category = "Characters")
+    int32 GetCharacterAdvancementLevel(const FName& CharacterClass) const;
     
     // Card System
     UFUNCTION(BlueprintCallable, Category = "Cards")
-    void AddCard(int32 CardID);
+    void CollectCard(const FName& CardName);
     
-    UFUNCTION(BlueprintCallable, Category = "Cards")
-    bool HasCard(int32 CardID) const;
+    UFUNCTION(BlueprintPure, Category = "Cards")
+    int32 GetCardCount(const FName& CardName) const;
     
     // Achievement System
     UFUNCTION(BlueprintCallable, Category = "Achievements")
@@ -86,12 +185,18 @@ public:
     UFUNCTION(BlueprintPure, Category = "Achievements")
     bool IsAchievementUnlocked(const FString& AchievementID) const;
     
-    // Events
-    UPROPERTY(BlueprintAssignable, Category = "Events")
-    FOnCurrencyChanged OnEssenceChanged;
+    UFUNCTION(BlueprintPure, Category = "Achievements")
+    bool IsAchievementIDUnlocked(EYCRAchievementID AchievementID) const;
+    
+    UFUNCTION(BlueprintPure, Category = "Achievements")
+    TArray<FString> GetUnlockedAchievements() const;
+    
+    /** Add to a custom achievement counter (e.g. from Blueprint gameplay), evaluated immediately */
+    UFUNCTION(BlueprintCallable, Category = "Achievements")
+    void AddToAchievementCounter(FName CounterName, int32 Delta);
     
-    UPROPERTY(BlueprintAssignable, Category = "Events")
-    FOnAchievementUnlocked OnAchievementUnlocked;
+    // Progress
+    const FPlayerProgressData& GetPlayerProgress() const;
     
 protected:
     UPROPERTY()
@@ -103,11 +208,106 @@ protected:
     UPROPERTY()
     UYCRSaveGame* CurrentSaveGame;
     
+    /** Changes within this window are coalesced into one save */
+    UPROPERTY(EditDefaultsOnly, Category = "Save Game", meta = (ClampMin = "0.0"))
+    float SaveDebounceSeconds = 2.0f;
+    
+    /** Journal size at which the next save rewrites the snapshot instead of appending */
+    UPROPERTY(EditDefaultsOnly, Category = "Save Game", meta = (ClampMin = "1024"))
+    int32 MaxJournalBytes = 64 * 1024;
+    
+    /** Achievement definitions, the built-in set is used when empty */
+    UPROPERTY(EditDefaultsOnly, Category = "Achievements")
+    TSoftObjectPtr<UYCRAchievementSet> AchievementSet;
+    
 private:
+    /** One stream per gameplay system, indexed by EYCRRandomStream */
+    TStaticArray<FRandomStream, static_cast<int32>(EYCRRandomStream::MAX)> RandomStreams;
+    
+    /** Seed requested through SetNextRunSeed, consumed by the next StartNewRun */
+    TOptional<int32> NextRunSeed;
+    
+    /** Progress changed since the last write was started */
+    bool bSaveDirty = false;
+    
+    /** Debounce timer for RequestSave */
+    FTimerHandle SaveDebounceHandle;
+    
+    /** Background write currently in flight */
+    TFuture<bool> PendingSaveWrite;
+    
+    /** Identifies the write in flight, so a late completion never consumes a newer one */
+    uint32 SaveWriteSerial = 0;
+    
+    /** What the write in flight carries, restored if it fails */
+    TArray<uint8> InFlightJournalBytes;
+    bool bInFlightCompaction = false;
+    
+    /** Progression changes since the last snapshot */
+    FYCRProgressJournal Journal;
+    
+    /** Next write must rewrite the snapshot (reset, replayed journal, journal disabled) */
+    bool bCompactionRequested = false;
+    
+    /** Evaluates only the achievements whose counters changed */
+    FYCRAchievementTracker AchievementTracker;
+    
+    /** AchievementSet streaming in, the tracker has no definitions until it arrives */
+    TSharedPtr<FStreamableHandle> AchievementSetLoadHandle;
+    
+    /** Loaded by LoadRunCheckpoint, consumed by the next StartRun */
+    TOptional<FYCRRunCheckpoint> PendingRunCheckpoint;
+    
+    /** Background checkpoint write currently in flight */
+    TFuture<bool> PendingCheckpointWrite;
+    
+    /** Map requested by PreloadMap, kept alive until the travel to it has finished */
+    FName PreloadedMapName;
+    
+    UPROPERTY()
+    UWorld* PreloadedMapWorld = nullptr;
+    
+    void OnMapPreloaded(const FName& PackageName, UPackage* LoadedPackage, EAsyncLoadingResult::Type Result);
+    
     void InitializeDefaultData();
+    void InitializeRandomStreams(int32 Seed);
     void CheckAndUnlockAchievements();
     
+    /** Compile the tracker from AchievementSet, streamed in alongside the class tables */
+    void LoadAchievementSetAsync();
+    
+    /** Seed lifetime counters and unlock bits from PlayerProgress */
+    void SyncAchievementTracker();
+    
+    /** Total.* counters mirror PlayerProgress, which only advances when a run ends */
+    void SyncLifetimeCounters();
+    
+    /** Apply a progression change, journal it and schedule a save */
+    void RecordProgress(FYCRJournalRecord Record);
+    
+    /** Currency and achievement events go through UYCRGameplayEventBus */
+    void PostCurrencyChanged(EYCRCurrency Currency, int32 NewAmount);
+    
+    /** Append queued journal records, or compact, on a background thread */
+    void WriteSaveAsync();
+    
+    /** Wait for the write in flight and re-queue its changes if it failed. @return false on failure */
+    bool ConsumeSaveWriteResult();
+    
+    /** Game thread completion of a background write, retries failed ones */
+    void OnSaveWriteFinished(uint32 Serial);
+    
+    /** Serialize the full progress snapshot (game thread only) */
+    bool SerializeSnapshot(TArray<uint8>& OutBytes) const;
+    
+    /** Temp file + rename so a crash mid-write never leaves a truncated save */
+    static bool WriteSaveFileAtomic(const FString& SlotName, int32 InUserIndex, const TArray<uint8>& SaveBytes);
+    
+    void OnPreLoadMap(const FString& MapName);
+    void OnPostLoadMap(UWorld* World);
+    
     // Save game constants
     const FString SaveSlotName = TEXT("YCRSaveSlot");
+    const FString RunCheckpointSlotName = TEXT("YCRRunCheckpoint");
     const int32 UserIndex = 0;
 };
\ No newline at end of file
@@ -12,8 +12,12 @@ class ACharacterPlayer;
 class AEnemyBase;
 class UYCRSpawnManager;
 class UYCRWaveManager;
+class UYCRRewardAggregator;
+class UYCRRunCheckpointComponent;
+class UYCRRunTelemetry;
+class UYCRPrewarmScheduler;
+class UYCREnemyBudgetController;
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRunTimeUpdated, float, CurrentRunTime);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBossSpawned, AActor*, BossActor);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnRunCompleted);
 
@@ -57,6 +61,12 @@ public:
     /** Check if run time limit reached */
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|GameMode")
     bool IsTimeLimitReached() const { return CurrentRunTime >= RunTimeLimit; }
+    
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|GameMode")
+    bool IsRunActive() const { return bRunActive; }
+    
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|GameMode")
+    bool IsBossSpawned() const { return bBossSpawned; }
 
     // =====================================================
     // Enemy Management
@@ -69,6 +79,33 @@ public:
     /** Get current enemy count */
     UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|GameMode")
     int32 GetCurrentEnemyCount() const { return CurrentEnemyCount; }
+    
+    /** Live enemy cap: MaxEnemyCount, or what the budget controller allows this machine (both within horde quality) */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|GameMode")
+    int32 GetEnemyCap() const;
+    
+    /** Spawners ask before spawning and report every spawn, deaths come in through OnEnemyKilled */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|GameMode")
+    bool CanSpawnEnemy() const;
+    
+    UFUNCTION(BlueprintCallable, Category = "YCR|GameMode")
+    void OnEnemySpawned(AEnemyBase* SpawnedEnemy);
+    
+    /** Scales enemy count, spawn rate and AI LOD to the frame time target */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|GameMode")
+    UYCREnemyBudgetController* GetEnemyBudget() const { return EnemyBudget; }
+    
+    /** Per-frame kill/loot collector */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|GameMode")
+    UYCRRewardAggregator* GetRewardAggregator() const { return RewardAggregator; }
+    
+    /** Periodic run snapshots for ContinueRun */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|GameMode")
+    UYCRRunCheckpointComponent* GetRunCheckpoint() const { return RunCheckpoint; }
+    
+    /** Per-second performance samples of the current run */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|GameMode")
+    UYCRRunTelemetry* GetRunTelemetry() const { return RunTelemetry; }
 
     // =====================================================
     // Boss Management
@@ -81,14 +118,15 @@ public:
     /** Called when boss is defeated */
     UFUNCTION(BlueprintCallable, Category = "YCR|GameMode")
     void OnBossDefeated();
+    
+    const TSoftClassPtr<AEnemyBase>& GetBossClass() const { return BossClass; }
+    float GetBossSpawnTime() const { return BossSpawnTime; }
 
     // =====================================================
     // Events
     // =====================================================
     
-    /** Called every second with current run time */
-    UPROPERTY(BlueprintAssignable, Category = "YCR|Events")
-    FOnRunTimeUpdated OnRunTimeUpdated;
+    // Run time updates are posted every second to UYCRGameplayEventBus
     
     /** Called when boss spawns */
     UPROPERTY(BlueprintAssignable, Category = "YCR|Events")
@@ -111,13 +149,13 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "YCR|Config")
     float BossSpawnTime = 540.0f;
     
-    /** Maximum enemies allowed at once */
+    /** Maximum enemies allowed at once, the reference the budget controller compensates difficulty against */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "YCR|Config")
     int32 MaxEnemyCount = 100;
     
-    /** Boss class to spawn */
+    /** Boss class to spawn, streamed in ahead of BossSpawnTime by the prewarm scheduler */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "YCR|Config")
-    TSubclassOf<AEnemyBase> BossClass;
+    TSoftClassPtr<AEnemyBase> BossClass;
 
     // =====================================================
     // Components
@@ -130,6 +168,26 @@ protected:
     /** Wave manager component */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "YCR|Components")
     UYCRWaveManager* WaveManager;
+    
+    /** Collects kills and drops per frame */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "YCR|Components")
+    UYCRRewardAggregator* RewardAggregator;
+    
+    /** Writes and restores run checkpoints */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "YCR|Components")
+    UYCRRunCheckpointComponent* RunCheckpoint;
+    
+    /** Records run telemetry and exports it when the run ends */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "YCR|Components")
+    UYCRRunTelemetry* RunTelemetry;
+    
+    /** Loads wave and boss classes ahead of time */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "YCR|Components")
+    UYCRPrewarmScheduler* PrewarmScheduler;
+    
+    /** Adapts the horde size to the machine */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "YCR|Components")
+    UYCREnemyBudgetController* EnemyBudget;
 
 private:
     // =====================================================
@@ -141,8 +199,12 @@ private:
     int32 CurrentEnemyCount = 0;
     int32 TotalEnemiesKilled = 0;
     bool bBossSpawned = false;
+    bool bDeathSwarmStarted = false;
     bool bRunActive = false;
     
+    /** Start loading the level a victory travels to */
+    void PreloadNextLevel();
+    
     /** Handle death swarm when time limit reached */
     void StartDeathSwarm();
     
@@ -27,14 +27,23 @@ public:
     
     virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // =====================================================
     // Menu Navigation
     // =====================================================
     
-    /** Start a new run with selected character */
+    /** Start a new run with selected character, with a fixed seed when bUseSeed is set (0 is a valid seed) */
     UFUNCTION(BlueprintCallable, Category = "YCR|Menu")
-    void StartNewRun(const FName& SelectedCharacter, int32 MapLevel = 1);
+    void StartNewRun(const FName& SelectedCharacter, int32 MapLevel = 1, bool bUseSeed = false, int32 Seed = 0);
+    
+    /** Character picked in the selection screen - starts streaming its assets */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Menu")
+    void SelectCharacter(const FName& CharacterClass);
+    
+    /** Map level picked in the menu - starts streaming the map's run content */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Menu")
+    void SelectMapLevel(int32 MapLevel);
     
     /** Continue from last checkpoint */
     UFUNCTION(BlueprintCallable, Category = "YCR|Menu")
@@ -108,21 +117,24 @@ protected:
     /** Available character classes */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "YCR|Config")
     TMap<FName, int32> CharacterUnlockCosts;
-    
-    /** Map names for level selection */
-    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "YCR|Config")
-    TArray<FName> MapNames = {
-        "VerdantPlains",
-        "ScorchingSands", 
-        "EnchantedForest",
-        "CursedCaverns"
-    };
 
 private:
     /** Cached game instance reference */
     UPROPERTY()
     UGameInstanceYCR* CachedGameInstance;
     
+    /** Menu bundle of the character creation data, released when the menu is left */
+    TArray<FPrimaryAssetId> MenuAssetIds;
+    
+    /** Load the InRun bundle of a map and the gems, unloading other maps' run content */
+    void PreloadRunContent(int32 MapLevel);
+    
+    /** Class whose assets are currently being prewarmed */
+    FName PrewarmedCharacter;
+    
+    /** Stream the class assets in, releasing the previously selected class */
+    void PrewarmCharacter(const FName& CharacterClass);
+    
     /** Initialize menu state from save data */
     void InitializeMenuState();
     
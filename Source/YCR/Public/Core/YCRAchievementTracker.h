@@ -0,0 +1,104 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Enums/EYCRAchievementID.h"
+
+class UYCRAchievementSet;
+
+/**
+ * Counters every game registers up front, so gameplay code can update
+ * them without a name lookup. The value is the counter handle.
+ */
+enum class EYCRAchievementCounter : uint8
+{
+    // Reset at the start of every run
+    RunMonstersKilled,
+    RunElitesKilled,
+    RunBossesKilled,
+    RunGoldCollected,
+    RunLevel,
+    RunDurationSeconds,
+    RunCompleted,
+
+    // Lifetime, seeded from the player progress on load
+    TotalMonstersKilled,
+    TotalElitesKilled,
+    TotalBossesKilled,
+    TotalGoldCollected,
+    TotalRunsPlayed,
+    TotalRunsWon,
+
+    MAX
+};
+
+/**
+ * Incremental achievement evaluation.
+ *
+ * Definitions are compiled into flat condition lists and indexed by the
+ * counters they read. Changing a counter only queues the locked achievements
+ * that depend on it; Evaluate() then checks just those. Unlocks are kept as
+ * a bitset indexed by EYCRAchievementID.
+ */
+class YCR_API FYCRAchievementTracker
+{
+public:
+    FYCRAchievementTracker();
+
+    /** Replace the definitions. Counter values and unlocks are kept. */
+    void Compile(const UYCRAchievementSet& AchievementSet);
+
+    // Counters
+    int32 GetCounterHandle(const FName& CounterName);
+    void SetCounter(int32 Handle, int64 Value);
+    void AddToCounter(int32 Handle, int64 Delta);
+    int64 GetCounter(int32 Handle) const;
+
+    void SetCounter(EYCRAchievementCounter Counter, int64 Value) { SetCounter(static_cast<int32>(Counter), Value); }
+    void AddToCounter(EYCRAchievementCounter Counter, int64 Delta) { AddToCounter(static_cast<int32>(Counter), Delta); }
+    int64 GetCounter(EYCRAchievementCounter Counter) const { return GetCounter(static_cast<int32>(Counter)); }
+
+    /** Zero all Run.* counters, Run.DurationSeconds stays unset until the run ends */
+    void ResetRunCounters();
+
+    // Unlocks
+    bool IsUnlocked(EYCRAchievementID AchievementID) const;
+    void MarkUnlocked(EYCRAchievementID AchievementID);
+    void ResetUnlocks();
+
+    /** Check the achievements whose counters changed since the last call */
+    void Evaluate(TArray<EYCRAchievementID>& OutNewlyUnlocked);
+
+private:
+    struct FCondition
+    {
+        int32 Counter = 0;
+        bool bAtMost = false;
+        int64 Threshold = 0;
+    };
+
+    struct FCompiledAchievement
+    {
+        EYCRAchievementID AchievementID = EYCRAchievementID::None;
+        int32 FirstCondition = 0;
+        int32 NumConditions = 0;
+    };
+
+    TArray<FCondition> Conditions;
+    TArray<FCompiledAchievement> Achievements;
+
+    TMap<FName, int32> CounterHandles;
+    TArray<int64> CounterValues;
+
+    /** Achievement indices reading each counter */
+    TArray<TArray<int32>> DependentsByCounter;
+
+    /** Achievements queued for Evaluate() */
+    TArray<int32> DirtyAchievements;
+    TBitArray<> DirtyBits;
+
+    /** Indexed by EYCRAchievementID */
+    TBitArray<> UnlockedBits;
+
+    void MarkDependentsDirty(int32 Handle);
+    bool AreConditionsMet(const FCompiledAchievement& Achievement) const;
+};
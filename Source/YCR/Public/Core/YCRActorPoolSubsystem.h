@@ -0,0 +1,60 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "YCRActorPoolSubsystem.generated.h"
+
+/**
+ * Per-world pool of deactivated actors (gems, pickups, enemies).
+ * Released actors are hidden and stripped of collision and actor/component ticks instead of destroyed,
+ * so bursts of spawns reuse existing actors instead of calling SpawnActor.
+ */
+UCLASS()
+class YCR_API UYCRActorPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /** Reuse a pooled actor of ActorClass or spawn a new one */
+    AActor* AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& Transform);
+
+    template<typename T>
+    T* AcquireActor(TSubclassOf<T> ActorClass, const FTransform& Transform)
+    {
+        return Cast<T>(AcquireActor(TSubclassOf<AActor>(ActorClass), Transform));
+    }
+
+    /** Deactivate Actor and keep it for reuse (destroys when the pool is full) */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Pool")
+    void ReleaseActor(AActor* Actor);
+
+    /** Spawn Count deactivated actors up front so later acquires never spawn */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Pool")
+    void PrewarmPool(TSubclassOf<AActor> ActorClass, int32 Count);
+
+    /** Drop all free actors of ActorClass */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Pool")
+    void TrimPool(TSubclassOf<AActor> ActorClass);
+
+    UFUNCTION(BlueprintPure, Category = "YCR|Pool")
+    int32 GetFreeCount(TSubclassOf<AActor> ActorClass) const;
+
+    /** Release when the pool is available, destroy otherwise */
+    static void ReleaseOrDestroy(AActor* Actor);
+
+    /** Upper bound of free actors kept per class */
+    static constexpr int32 MaxFreeActorsPerClass = 512;
+
+private:
+    /** Free (deactivated) actors per class */
+    TMap<TObjectKey<UClass>, TArray<TWeakObjectPtr<AActor>>> FreeActors;
+
+    /** Same actors as FreeActors, to reject releasing an actor that is already in the pool */
+    TSet<TWeakObjectPtr<AActor>> FreeActorSet;
+
+    AActor* SpawnPooledActor(UClass* ActorClass, const FTransform& Transform) const;
+    static void SetActorActive(AActor* Actor, bool bActive);
+    static void ResetVelocity(AActor* Actor);
+};
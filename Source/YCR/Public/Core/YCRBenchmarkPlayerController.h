@@ -0,0 +1,92 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/PlayerController.h"
+#include "YCRBenchmarkPlayerController.generated.h"
+
+class ACharacterPlayer;
+
+/**
+ * Player controller that plays a run on its own for reproducible perf captures.
+ * Selected by AInGameMode when the command line contains -YCRBot.
+ *
+ * Strategy, re-evaluated on a fixed game-time interval:
+ *  - walk to and open chests (IIInteractableInterface) that are close enough
+ *  - otherwise walk to the nearest experience gem
+ *  - otherwise circle strafe around the spot the run started at
+ *  - always steer away from nearby enemies, weighted by distance
+ * Orbit direction changes come from a stream seeded with the run seed, so a seeded run
+ * (-YCRSeed) at a fixed timestep (-YCRSimulate) replays the same path every build.
+ * All movement goes through ACharacterPlayer::ApplyMoveInput, the path the Move action uses.
+ */
+UCLASS()
+class YCR_API AYCRBenchmarkPlayerController : public APlayerController
+{
+    GENERATED_BODY()
+
+public:
+    AYCRBenchmarkPlayerController();
+
+    virtual void PlayerTick(float DeltaTime) override;
+
+    /** True when the command line asks for the bot */
+    static bool IsRequested();
+
+protected:
+    virtual void OnPossess(APawn* InPawn) override;
+
+    // =====================================================
+    // Configuration
+    // =====================================================
+
+    /** Game time between decisions; movement input is applied every frame */
+    UPROPERTY(EditDefaultsOnly, Category = "YCR|Bot", meta = (ClampMin = "0.01"))
+    float DecisionInterval = 0.1f;
+
+    UPROPERTY(EditDefaultsOnly, Category = "YCR|Bot")
+    float OrbitRadius = 1200.0f;
+
+    /** Seconds between possible orbit direction flips */
+    UPROPERTY(EditDefaultsOnly, Category = "YCR|Bot")
+    float OrbitFlipInterval = 20.0f;
+
+    UPROPERTY(EditDefaultsOnly, Category = "YCR|Bot")
+    float ThreatRadius = 600.0f;
+
+    /** How strongly nearby enemies push the bot away compared to its goal */
+    UPROPERTY(EditDefaultsOnly, Category = "YCR|Bot")
+    float ThreatWeight = 1.5f;
+
+    UPROPERTY(EditDefaultsOnly, Category = "YCR|Bot")
+    float GemSearchRadius = 1500.0f;
+
+    UPROPERTY(EditDefaultsOnly, Category = "YCR|Bot")
+    float ChestSearchRadius = 2500.0f;
+
+    /** Must stay inside the player's interaction radius */
+    UPROPERTY(EditDefaultsOnly, Category = "YCR|Bot")
+    float InteractRadius = 150.0f;
+
+private:
+    FRandomStream BotStream;
+    FVector OrbitCenter = FVector::ZeroVector;
+    float OrbitSign = 1.0f;
+
+    /** Move input (right, forward) applied until the next decision */
+    FVector2D CurrentInput = FVector2D::ZeroVector;
+
+    double NextDecisionTime = 0.0;
+    double NextOrbitFlipTime = 0.0;
+    bool bStarted = false;
+
+    /** Seed and reset once the run (and with it the run seed) has started */
+    void StartBot(double Now);
+    void Decide(ACharacterPlayer* Player, double Now);
+
+    /** Goal position for this decision, false while orbiting */
+    bool FindChestGoal(const ACharacterPlayer* Player, FVector& OutGoal, AActor*& OutChest) const;
+    bool FindGemGoal(const ACharacterPlayer* Player, FVector& OutGoal) const;
+
+    FVector GetOrbitDirection(const FVector& Location) const;
+    FVector GetThreatAvoidance(const FVector& Location) const;
+};
@@ -7,6 +7,8 @@
 #include "YCR/Public/Enums/EYCRCharacterClasses.h"
 #include "YCR/Public/Enums/EYCRElements.h"
 #include "Engine/DataTable.h"
+#include "Engine/StreamableManager.h"
+#include "YCR/Public/Data/CharacterClassData.h"
 #include "YCRCharacterCreator.generated.h"
 
 // Forward declarations
@@ -64,7 +66,7 @@ struct FYCRCharacterCreationData : public FTableRowBase
 
     /** Icon for UI representation */
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UI")
-    UTexture2D* ClassIcon;
+    UTexture2D* ClassIcon = nullptr;
 
     FYCRCharacterCreationData()
     {
@@ -74,6 +76,40 @@ struct FYCRCharacterCreationData : public FTableRowBase
     }
 };
 
+/**
+ * Per-class data indexed by EYCRCharacterClasses.
+ * Built once at startup from the creation and class data tables,
+ * read-only afterwards so lookups hand out references instead of copies.
+ */
+struct YCR_API FYCRCharacterClassTable
+{
+    static constexpr int32 NumClasses = static_cast<int32>(EYCRCharacterClasses::MAX);
+
+    /**
+     * Fill from the data tables. Creation rows are matched by row name (enum name),
+     * class rows by their JobClassType.
+     * @return Number of playable classes without a creation row
+     */
+    int32 Build(const UDataTable* CreationDataTable, const UDataTable* ClassDataTable);
+
+    bool IsBuilt() const { return bBuilt; }
+
+    bool HasCreationData(EYCRCharacterClasses CharacterClass) const;
+
+    /** Row of the class, an empty default row if it has none */
+    const FYCRCharacterCreationData& GetCreationData(EYCRCharacterClasses CharacterClass) const;
+
+    /** Class row (unlocks, advancement), null if the class has none */
+    const FCharacterClassData* FindClassData(EYCRCharacterClasses CharacterClass) const;
+
+private:
+    TStaticArray<FYCRCharacterCreationData, NumClasses> CreationData;
+    TStaticArray<FCharacterClassData, NumClasses> ClassData;
+    TBitArray<> HasCreationRow;
+    TBitArray<> HasClassRow;
+    bool bBuilt = false;
+};
+
 /**
  * Character Creator utility class
  * Handles the creation and initialization of player characters based on job class
@@ -84,8 +120,6 @@ class YCR_API UYCRCharacterCreator : public UObject
     GENERATED_BODY()
 
 public:
-    UYCRCharacterCreator();
-
     /**
      * Create a new player character with specified class
      * @param World - World context
@@ -102,6 +136,30 @@ public:
         const FRotator& SpawnRotation
     );
 
+    /**
+     * Start streaming the mesh and animation blueprint of a class.
+     * Call as soon as the class is selected so spawning never waits on disk.
+     * @param CharacterClass - The job class to load assets for
+     * @param OnLoaded - Called once the assets are resident (immediately if they already are)
+     * @return Handle of the load, kept alive until ReleaseCharacterAssets
+     */
+    static TSharedPtr<FStreamableHandle> PreloadCharacterAssets(
+        EYCRCharacterClasses CharacterClass,
+        FStreamableDelegate OnLoaded = FStreamableDelegate()
+    );
+
+    /** Start streaming a class from the out-game menu */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Character Creation")
+    static void PrewarmCharacterClass(EYCRCharacterClasses CharacterClass);
+
+    /** Are the visual assets of a class resident */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "YCR|Character Creation")
+    static bool AreCharacterAssetsLoaded(EYCRCharacterClasses CharacterClass);
+
+    /** Drop the preload handle of a class, the assets stay loaded while a character uses them */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Character Creation")
+    static void ReleaseCharacterAssets(EYCRCharacterClasses CharacterClass);
+
     /**
      * Initialize character with class-specific data
      * @param Character - Character to initialize
@@ -115,7 +173,7 @@ public:
     );
 
     /**
-     * Get character creation data for a specific class
+     * Get character creation data for a specific class (Blueprint copy)
      * @param CharacterClass - The job class to query
      * @param OutData - The character creation data
      * @return Whether data was found
@@ -126,14 +184,31 @@ public:
         FYCRCharacterCreationData& OutData
     );
 
+    /** Stream the class data tables in and build the class table once they arrive (called from UGameInstanceYCR::Init) */
+    static void LoadClassTableAsync();
+
+    /** Build the class table now, loading the data tables synchronously if they are not resident yet */
+    static void BuildClassTable();
+
+    /** Class table, built on first use if startup did not build it */
+    static const FYCRCharacterClassTable& GetClassTable();
+
+    /** Creation row of a class without copying, check HasCreationData first */
+    static const FYCRCharacterCreationData& GetCreationData(EYCRCharacterClasses CharacterClass)
+    {
+        return GetClassTable().GetCreationData(CharacterClass);
+    }
+
     /**
-     * Apply visual customization to character
+     * Apply visual customization to character.
+     * Never loads synchronously - assets that are not resident yet are
+     * streamed in and applied when they arrive.
      * @param Character - Character to customize
-     * @param CreationData - Data containing visual information
+     * @param CharacterClass - Class whose creation data holds the visuals
      */
     static void ApplyCharacterVisuals(
         ACharacterPlayer* Character,
-        const FYCRCharacterCreationData& CreationData
+        EYCRCharacterClasses CharacterClass
     );
 
     /**
@@ -156,16 +231,25 @@ public:
         const FYCRCharacterCreationData& CreationData
     );
 
-protected:
-    /** Data table containing character creation data for all classes */
-    UPROPERTY(EditDefaultsOnly, Category = "YCR|Character Creation")
-    UDataTable* CharacterCreationDataTable;
+private:
+    /** All class rows, indexed by EYCRCharacterClasses */
+    static FYCRCharacterClassTable ClassTable;
 
-    /** Default player character class to spawn */
-    UPROPERTY(EditDefaultsOnly, Category = "YCR|Character Creation")
-    TSubclassOf<ACharacterPlayer> PlayerCharacterClass;
+    /** Running or completed preloads, keeping the class assets resident */
+    static TMap<EYCRCharacterClasses, TSharedPtr<FStreamableHandle>> PreloadHandles;
 
-private:
-    /** Cache of loaded character creation data */
-    static TMap<EYCRCharacterClasses, FYCRCharacterCreationData> CachedCreationData;
+    /** Callers waiting on a preload that is still streaming, run by its completion */
+    static TMap<EYCRCharacterClasses, TArray<FStreamableDelegate>> PendingPreloadCallbacks;
+
+    /** Keeps the data tables loaded, they are referenced from UYCRDeveloperSettings only softly */
+    static TSharedPtr<FStreamableHandle> ClassTableLoadHandle;
+
+    /** Apply whichever visual assets are currently loaded */
+    static void ApplyResidentVisuals(ACharacterPlayer* Character, const FYCRCharacterCreationData& CreationData);
+
+    /** Soft paths of the data tables the class table is built from */
+    static void GetClassTablePaths(TArray<FSoftObjectPath>& OutPaths);
+
+    /** Soft paths of the assets a class needs before it can be spawned */
+    static void GetCharacterAssetPaths(const FYCRCharacterCreationData& CreationData, TArray<FSoftObjectPath>& OutPaths);
 };
\ No newline at end of file
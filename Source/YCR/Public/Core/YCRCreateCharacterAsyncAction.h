@@ -0,0 +1,58 @@
+﻿// Copyright YCR. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "YCR/Public/Enums/EYCRCharacterClasses.h"
+#include "YCRCreateCharacterAsyncAction.generated.h"
+
+class ACharacterPlayer;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCharacterCreated, ACharacterPlayer*, Character);
+
+/**
+ * Latent Blueprint node for character creation.
+ * Waits for the class assets to be resident (usually already prewarmed from
+ * the menu), then spawns and initializes the character in one frame.
+ */
+UCLASS()
+class YCR_API UYCRCreateCharacterAsyncAction : public UBlueprintAsyncActionBase
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Create a player character once its assets are loaded
+     * @param WorldContextObject - World context
+     * @param CharacterClass - The job class to create
+     * @param SpawnLocation - Where to spawn the character
+     * @param SpawnRotation - Initial rotation
+     */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Character Creation",
+        meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+    static UYCRCreateCharacterAsyncAction* CreatePlayerCharacterAsync(
+        UObject* WorldContextObject,
+        EYCRCharacterClasses CharacterClass,
+        const FVector& SpawnLocation,
+        const FRotator& SpawnRotation
+    );
+
+    virtual void Activate() override;
+
+    /** Character spawned and initialized */
+    UPROPERTY(BlueprintAssignable)
+    FOnCharacterCreated OnCreated;
+
+    /** World went away or the spawn failed */
+    UPROPERTY(BlueprintAssignable)
+    FOnCharacterCreated OnFailed;
+
+private:
+    TWeakObjectPtr<UObject> WorldContext;
+    EYCRCharacterClasses CharacterClass = EYCRCharacterClasses::None;
+    FVector SpawnLocation = FVector::ZeroVector;
+    FRotator SpawnRotation = FRotator::ZeroRotator;
+
+    void OnAssetsLoaded();
+};
@@ -0,0 +1,60 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "YCRDeveloperSettings.generated.h"
+
+class ACharacterPlayer;
+class UDataTable;
+
+/**
+ * Project-wide YCR asset references (Project Settings > Game > YCR).
+ * Everything is a soft reference so nothing is loaded when the CDO is created.
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "YCR"))
+class YCR_API UYCRDeveloperSettings : public UDeveloperSettings
+{
+    GENERATED_BODY()
+
+public:
+    UYCRDeveloperSettings();
+
+    virtual FName GetCategoryName() const override { return TEXT("Game"); }
+
+    /** Character creation data for all classes (rows named after EYCRCharacterClasses) */
+    UPROPERTY(Config, EditAnywhere, Category = "Character Creation")
+    TSoftObjectPtr<UDataTable> CharacterCreationDataTable;
+
+    /** Unlock and advancement data for all classes (optional) */
+    UPROPERTY(Config, EditAnywhere, Category = "Character Creation")
+    TSoftObjectPtr<UDataTable> CharacterClassDataTable;
+
+    /** Player character spawned by UYCRCharacterCreator */
+    UPROPERTY(Config, EditAnywhere, Category = "Character Creation")
+    TSoftClassPtr<ACharacterPlayer> PlayerCharacterClass;
+
+    /** Map regions in unlock order, each has LevelsPerMap levels named <Region>_L<n> */
+    UPROPERTY(Config, EditAnywhere, Category = "Maps")
+    TArray<FName> MapRegions;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Maps", meta = (ClampMin = "1"))
+    int32 LevelsPerMap = 5;
+
+    /** Folder holding the level maps, used to preload the next level before travelling */
+    UPROPERTY(Config, EditAnywhere, Category = "Maps", meta = (LongPackageName))
+    FDirectoryPath MapDirectory;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Maps")
+    FName MainMenuMap = TEXT("MainMenu");
+
+    /** Region of a map level (1-based), None if out of range */
+    FName GetMapRegion(int32 MapLevel) const;
+
+    /** <Region>_L<n> for a map level, None if out of range */
+    FName GetLevelMapName(int32 MapLevel) const;
+
+    /** Long package name of a map inside MapDirectory, the plain name if no directory is set */
+    FString GetMapPackageName(FName MapName) const;
+
+    static const UYCRDeveloperSettings* Get() { return GetDefault<UYCRDeveloperSettings>(); }
+};
@@ -0,0 +1,23 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "YCRFallbackRandomSubsystem.generated.h"
+
+/**
+ * Random stream for worlds without a UGameInstanceYCR (editor previews, tools).
+ * One per world so previews never advance each other's sequence.
+ * Game worlds use the seeded run streams of UGameInstanceYCR::GetRandomStream instead.
+ */
+UCLASS()
+class YCR_API UYCRFallbackRandomSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /** Deterministic per world, not per run */
+    FRandomStream& GetStream() { return Stream; }
+
+private:
+    FRandomStream Stream{ 0 };
+};
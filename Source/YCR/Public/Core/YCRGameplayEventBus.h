@@ -0,0 +1,201 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "YCRGameplayEventBus.generated.h"
+
+// =====================================================
+// Event Payloads
+// =====================================================
+
+/** Channels of the bus, one per payload type */
+enum class EYCRGameplayEvent : uint8
+{
+    RunTime,
+    Currency,
+    ExpGemDropped,
+    CoinDropped,
+    AchievementUnlocked,
+
+    MAX
+};
+
+UENUM(BlueprintType)
+enum class EYCRCurrency : uint8
+{
+	Gold            UMETA(DisplayName = "Gold"),
+	Essence         UMETA(DisplayName = "Essence")
+};
+
+struct FYCRRunTimeEvent
+{
+    static constexpr EYCRGameplayEvent Type = EYCRGameplayEvent::RunTime;
+
+    float RunTime = 0.0f;
+};
+
+struct FYCRCurrencyEvent
+{
+    static constexpr EYCRGameplayEvent Type = EYCRGameplayEvent::Currency;
+
+    EYCRCurrency Currency = EYCRCurrency::Gold;
+    int32 NewAmount = 0;
+};
+
+struct FYCRExpGemDroppedEvent
+{
+    static constexpr EYCRGameplayEvent Type = EYCRGameplayEvent::ExpGemDropped;
+
+    FVector Location = FVector::ZeroVector;
+    int32 ExpValue = 0;
+};
+
+struct FYCRCoinDroppedEvent
+{
+    static constexpr EYCRGameplayEvent Type = EYCRGameplayEvent::CoinDropped;
+
+    FVector Location = FVector::ZeroVector;
+    int32 CoinValue = 0;
+};
+
+struct FYCRAchievementUnlockedEvent
+{
+    static constexpr EYCRGameplayEvent Type = EYCRGameplayEvent::AchievementUnlocked;
+
+    FName AchievementID;
+};
+
+// =====================================================
+// Blueprint Adapter Delegates (once per frame)
+// =====================================================
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRunTimeUpdated, float, CurrentRunTime);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCurrencyChanged, EYCRCurrency, Currency, int32, NewAmount);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnExpGemsDropped, int32, GemCount, int32, TotalExp);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCoinsDropped, int32, DropCount, int32, TotalCoins);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAchievementsUnlocked, const TArray<FName>&, AchievementIDs);
+
+/**
+ * Native gameplay event bus for high-frequency events.
+ * Posting appends a POD payload to the channel's frame buffer; once per frame every native
+ * listener receives the whole buffer in one call, so dispatch cost grows with listeners and
+ * not with events. Blueprint gets one aggregated broadcast per channel and frame through the
+ * adapter delegates below, which are themselves just another batched listener.
+ */
+UCLASS()
+class YCR_API UYCRGameplayEventBus : public UGameInstanceSubsystem, public FTickableGameObject
+{
+    GENERATED_BODY()
+
+public:
+    template<typename TEvent>
+    using FListener = TDelegate<void(TConstArrayView<TEvent>)>;
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    static UYCRGameplayEventBus* Get(const UObject* WorldContextObject);
+
+    // =====================================================
+    // Native API
+    // =====================================================
+
+    template<typename TEvent>
+    void Post(const TEvent& Event)
+    {
+        GetChannel<TEvent>().Events.Add(Event);
+    }
+
+    template<typename TEvent>
+    FDelegateHandle Subscribe(FListener<TEvent>&& Listener)
+    {
+        return GetChannel<TEvent>().Listeners.Add(MoveTemp(Listener));
+    }
+
+    template<typename TEvent>
+    void Unsubscribe(FDelegateHandle Handle)
+    {
+        GetChannel<TEvent>().Listeners.Remove(Handle);
+    }
+
+    /** Dispatch everything posted since the last flush (normally once per frame) */
+    void Flush();
+
+    // FTickableGameObject
+    virtual void Tick(float DeltaTime) override { Flush(); }
+    virtual TStatId GetStatId() const override { RETURN_QUICK_DECLARE_CYCLE_STAT(UYCRGameplayEventBus, STATGROUP_Tickables); }
+    virtual bool IsTickable() const override { return !IsTemplate(); }
+    virtual bool IsTickableWhenPaused() const override { return true; }
+
+    // =====================================================
+    // Blueprint Adapter
+    // =====================================================
+
+    /** Latest run time of the frame */
+    UPROPERTY(BlueprintAssignable, Category = "YCR|Events")
+    FOnRunTimeUpdated OnRunTimeUpdated;
+
+    /** Latest amount per currency that changed this frame */
+    UPROPERTY(BlueprintAssignable, Category = "YCR|Events")
+    FOnCurrencyChanged OnCurrencyChanged;
+
+    UPROPERTY(BlueprintAssignable, Category = "YCR|Events")
+    FOnExpGemsDropped OnExpGemsDropped;
+
+    UPROPERTY(BlueprintAssignable, Category = "YCR|Events")
+    FOnCoinsDropped OnCoinsDropped;
+
+    UPROPERTY(BlueprintAssignable, Category = "YCR|Events")
+    FOnAchievementsUnlocked OnAchievementsUnlocked;
+
+private:
+    struct FChannelBase
+    {
+        virtual ~FChannelBase() = default;
+        virtual void Dispatch() = 0;
+    };
+
+    template<typename TEvent>
+    struct TChannel : FChannelBase
+    {
+        static_assert(TIsTriviallyDestructible<TEvent>::Value, "Gameplay event payloads must be plain data");
+
+        TArray<TEvent> Events;
+
+        /** Events being broadcast, swapped with Events so both keep their capacity */
+        TArray<TEvent> Dispatching;
+
+        TMulticastDelegate<void(TConstArrayView<TEvent>)> Listeners;
+
+        virtual void Dispatch() override
+        {
+            if (Events.IsEmpty())
+            {
+                return;
+            }
+
+            // Listeners may Post: those events land in the emptied Events and go out on the next flush,
+            // they can neither reallocate the broadcast view nor get dropped by the reset
+            Swap(Events, Dispatching);
+            Listeners.Broadcast(Dispatching);
+            Dispatching.Reset();
+        }
+    };
+
+    TStaticArray<TUniquePtr<FChannelBase>, static_cast<int32>(EYCRGameplayEvent::MAX)> Channels;
+
+    template<typename TEvent>
+    TChannel<TEvent>& GetChannel()
+    {
+        return static_cast<TChannel<TEvent>&>(*Channels[static_cast<int32>(TEvent::Type)]);
+    }
+
+    template<typename TEvent>
+    void CreateChannel()
+    {
+        Channels[static_cast<int32>(TEvent::Type)] = MakeUnique<TChannel<TEvent>>();
+    }
+
+    void BindBlueprintAdapter();
+};
@@ -27,21 +27,23 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Gem", meta = (ClampMin = "1"))
     int32 ExperienceValue = 1;
 
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Gem")
-    class UStaticMesh* GemMesh;
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Gem", meta = (AssetBundles = "InRun"))
+    TSoftObjectPtr<class UStaticMesh> GemMesh;
 
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Gem")
-    class UMaterialInterface* GemMaterial;
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Gem", meta = (AssetBundles = "InRun"))
+    TSoftObjectPtr<class UMaterialInterface> GemMaterial;
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Gem")
     FVector MeshScale = FVector(1.0f, 1.0f, 1.0f);
 
     // Optional effects
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Effects")
-    class UParticleSystem* CollectionEffect;
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Effects", meta = (AssetBundles = "InRun"))
+    TSoftObjectPtr<class UParticleSystem> CollectionEffect;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Effects", meta = (AssetBundles = "InRun"))
+    TSoftObjectPtr<class USoundBase> CollectionSound;
 
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Effects")
-    class USoundBase* CollectionSound;
+    virtual FPrimaryAssetId GetPrimaryAssetId() const override;
 
     // Helper function to get experience value based on monster type
     UFUNCTION(BlueprintPure, Category = "Gem")
@@ -76,4 +78,32 @@ public:
         EYCRMonsterType MonsterType,
         int32 GemCount = 1
     );
+
+    /**
+     * Spawn many gems in one call
+     * Resolves the world and pool once and reuses pooled pickups instead of SpawnActor per gem.
+     * @param Locations - One location per gem
+     * @param ExperienceValues - Experience per gem; a single value applies to all gems
+     * @return Number of gems placed
+     */
+    UFUNCTION(BlueprintCallable, Category = "Gem", meta = (WorldContext = "WorldContextObject"))
+    static int32 SpawnGemsBatch(
+        UObject* WorldContextObject,
+        TSubclassOf<class AYCRGemPickup> GemClass,
+        const TArray<FVector>& Locations,
+        EYCRGemColor GemColor,
+        const TArray<int32>& ExperienceValues
+    );
+
+    /**
+     * Compute scatter positions for GemCount gems around Center in one pass
+     * Sunflower (golden angle) pattern so large drops do not stack, jittered by the gem scatter stream.
+     */
+    static void ComputeScatterLocations(
+        const FVector& Center,
+        int32 GemCount,
+        float Radius,
+        const FRandomStream& Stream,
+        TArray<FVector>& OutLocations
+    );
 };
\ No newline at end of file
@@ -0,0 +1,44 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * CPU-side scalability for swarms, the gameplay counterpart of the graphics scalability groups.
+ * sg.HordeQuality (0 = Low .. 3 = Epic) applies the [HordeQuality@N] section of DefaultScalability.ini
+ * to the horde.* cvars; device profiles pick the level per platform. Single horde.* cvars can still
+ * be overridden from device profiles, -dpcvars or the console.
+ */
+struct YCR_API FYCRHordeScalability
+{
+    static constexpr int32 NumQualityLevels = 4;
+
+    static int32 GetQualityLevel();
+
+    /** Change the level from the options menu */
+    static void SetQualityLevel(int32 Level);
+
+    /** Apply the ini section of the current level (the level can be set by a device profile before the cvar exists) */
+    static void ApplyQualityLevel();
+
+    // =====================================================
+    // Values (enemy cap, AI LOD, status effects, corpses)
+    // =====================================================
+
+    /** Hard ceiling for live enemies, above any budget bound */
+    static int32 GetMaxLiveEnemies();
+
+    /** Multiplier on the enemy AI LOD distance bounds */
+    static float GetAILodDistanceScale();
+
+    /** Live experience gems before new drops merge into existing ones (no gem consolidation reads it yet) */
+    static int32 GetGemConsolidationBudget();
+
+    /** Live projectiles before new ones are refused (no projectile system reads it yet) */
+    static int32 GetMaxProjectiles();
+
+    /** Seconds between status effect ticks, 0 = every frame */
+    static float GetStatusEffectTickInterval();
+
+    /** Seconds a dead enemy stays before it is removed */
+    static float GetCorpseLifetime();
+};
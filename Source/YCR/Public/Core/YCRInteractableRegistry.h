@@ -0,0 +1,101 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "YCRInteractableRegistry.generated.h"
+
+class ACharacter;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractableFocusChanged, AActor*, FocusedInteractable);
+
+/**
+ * Per-world registry of IIInteractableInterface actors (chests, shrines, vendors, NPCs).
+ * Actors are bucketed by position in a uniform 2D grid, so "closest interactable" is a
+ * handful of cell lookups instead of a physics sweep. Interactables in the level and
+ * spawned later register automatically and leave on EndPlay; ones that move call
+ * UpdateInteractable.
+ */
+UCLASS()
+class YCR_API UYCRInteractableRegistry : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    // =====================================================
+    // Registration
+    // =====================================================
+
+    /** Add Actor at its current location (ignored unless it implements IIInteractableInterface) */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Interaction")
+    void RegisterInteractable(AActor* Actor);
+
+    UFUNCTION(BlueprintCallable, Category = "YCR|Interaction")
+    void UnregisterInteractable(AActor* Actor);
+
+    /** Re-bucket Actor after it moved */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Interaction")
+    void UpdateInteractable(AActor* Actor);
+
+    // =====================================================
+    // Queries
+    // =====================================================
+
+    /** Closest visible interactable within Radius (2D) that Interactor can use, or any when Interactor is null */
+    UFUNCTION(BlueprintPure, Category = "YCR|Interaction")
+    AActor* FindClosestInteractable(const FVector& Location, float Radius, ACharacter* Interactor) const;
+
+    UFUNCTION(BlueprintPure, Category = "YCR|Interaction")
+    int32 GetNumInteractables() const { return EntryIndices.Num(); }
+
+    // =====================================================
+    // Focus Tracking (interaction prompts)
+    // =====================================================
+
+    /** Track the closest interactable around Interactor every frame; null stops tracking */
+    UFUNCTION(BlueprintCallable, Category = "YCR|Interaction")
+    void SetFocusTracker(ACharacter* Interactor, float Radius);
+
+    UFUNCTION(BlueprintPure, Category = "YCR|Interaction")
+    AActor* GetFocusedInteractable() const { return FocusedInteractable.Get(); }
+
+    /** Fired when the tracked closest interactable changes (null when none is in range) */
+    UPROPERTY(BlueprintAssignable, Category = "YCR|Events")
+    FOnInteractableFocusChanged OnFocusChanged;
+
+    /** Grid cell edge length, about twice the usual interaction radius */
+    static constexpr float CellSize = 500.0f;
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+        FVector Location = FVector::ZeroVector;
+        FIntPoint Cell = FIntPoint::ZeroValue;
+    };
+
+    TSparseArray<FEntry> Entries;
+    TMap<TObjectKey<AActor>, int32> EntryIndices;
+
+    /** Entry indices per grid cell */
+    TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> Cells;
+
+    TWeakObjectPtr<ACharacter> FocusTracker;
+    float FocusRadius = 0.0f;
+    TWeakObjectPtr<AActor> FocusedInteractable;
+
+    FDelegateHandle ActorSpawnedHandle;
+
+    static FIntPoint GetCell(const FVector& Location);
+    void AddToCell(int32 EntryIndex);
+    void RemoveFromCell(int32 EntryIndex);
+
+    void HandleActorSpawned(AActor* Actor);
+
+    UFUNCTION()
+    void HandleActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+};
@@ -0,0 +1,120 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPlayerProgressData;
+
+/**
+ * Kind of progression change stored in the journal.
+ * Values are written to disk - append new entries at the end only.
+ */
+enum class EYCRJournalOp : uint8
+{
+    AddEssence,
+    UnlockMap,
+    UnlockCharacter,
+    CollectCard,
+    UnlockAchievement,
+    RunResult,
+
+    MAX
+};
+
+/**
+ * One progression change. Applying every record in sequence order to the
+ * last snapshot reproduces the current FPlayerProgressData.
+ */
+struct YCR_API FYCRJournalRecord
+{
+    EYCRJournalOp Op = EYCRJournalOp::AddEssence;
+
+    /** Strictly increasing per profile, records at or below the snapshot sequence are already folded in */
+    int64 Sequence = 0;
+
+    /** Character class or card name */
+    FName Name;
+
+    /** Achievement ID */
+    FString Text;
+
+    /** Essence delta, map level or advancement level */
+    int32 Value = 0;
+
+    // Run result
+    bool bVictory = false;
+    int32 Level = 0;
+    int32 MonstersKilled = 0;
+    int32 ElitesKilled = 0;
+    int32 BossesKilled = 0;
+    int32 GoldCollected = 0;
+
+    static FYCRJournalRecord MakeAddEssence(int32 Amount);
+    static FYCRJournalRecord MakeUnlockMap(int32 MapLevel);
+    static FYCRJournalRecord MakeUnlockCharacter(const FName& CharacterClass, int32 AdvancementLevel);
+    static FYCRJournalRecord MakeCollectCard(const FName& CardName);
+    static FYCRJournalRecord MakeUnlockAchievement(const FString& AchievementID);
+    static FYCRJournalRecord MakeRunResult(bool bInVictory, int32 InLevel, int32 InMonstersKilled,
+        int32 InElitesKilled, int32 InBossesKilled, int32 InGoldCollected);
+
+    /** Only the fields used by Op are written */
+    void Serialize(FArchive& Ar);
+
+    void ApplyTo(FPlayerProgressData& Progress) const;
+};
+
+/**
+ * Append-only progression journal next to the save slot.
+ *
+ * Records are queued in memory, appended to <Slot>.journal by the save writer
+ * and folded into the snapshot on compaction. Every record is framed with its
+ * size and CRC so a torn write at the end of the file is detected and dropped.
+ */
+class YCR_API FYCRProgressJournal
+{
+public:
+    /** Empty path disables the journal (every save becomes a compaction) */
+    void Initialize(const FString& InFilePath);
+
+    bool IsEnabled() const { return !FilePath.IsEmpty(); }
+    const FString& GetFilePath() const { return FilePath; }
+
+    /** Assign the next sequence number and queue the record for the next write */
+    void Append(FYCRJournalRecord& Record);
+
+    bool HasPending() const { return PendingBytes.Num() > 0; }
+
+    /** Hand the queued bytes to the writer */
+    TArray<uint8> TakePending();
+
+    /** Put bytes from a failed write back in front of the queue */
+    void RestorePending(TArray<uint8>&& Bytes);
+
+    /** Size of the journal on disk including queued bytes */
+    int64 GetJournalSize() const { return JournalBytes + PendingBytes.Num(); }
+
+    int64 GetLastSequence() const { return LastSequence; }
+
+    /**
+     * Apply every valid record newer than SnapshotSequence to Progress
+     * @return Number of records applied
+     */
+    int32 Replay(int64 SnapshotSequence, FPlayerProgressData& Progress);
+
+    /** Snapshot now contains everything, start a new journal */
+    void OnCompacted();
+
+    // File operations, safe to call from worker threads
+    static bool AppendToFile(const FString& InFilePath, const TArray<uint8>& Bytes);
+    static bool DeleteJournalFile(const FString& InFilePath);
+
+private:
+    FString FilePath;
+
+    /** Encoded records not yet handed to the writer */
+    TArray<uint8> PendingBytes;
+
+    /** Bytes already handed to the writer since the last compaction */
+    int64 JournalBytes = 0;
+
+    int64 LastSequence = 0;
+};
@@ -0,0 +1,93 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "Data/YCRSaveGameData.h"
+
+/**
+ * Enemy as stored in a checkpoint (12 bytes)
+ */
+struct FYCRCheckpointEnemy
+{
+    uint16 ClassIndex = 0;
+
+    /** Offset from FYCRRunCheckpoint::Origin in 10 cm units */
+    int16 Position[3] = { 0, 0, 0 };
+
+    uint8 Yaw = 0;
+    uint8 Level = 1;
+
+    /** Health / MaxHealth scaled to 0-255 */
+    uint8 HealthFraction = 255;
+};
+
+/**
+ * Pickup lying on the ground (13 bytes)
+ */
+struct FYCRCheckpointGem
+{
+    uint16 ClassIndex = 0;
+    int16 Position[3] = { 0, 0, 0 };
+
+    /** EYCRGemColor and experience, pooled pickups keep whatever they were last set to */
+    uint8 GemColor = 0;
+    int32 ExperienceValue = 1;
+};
+
+struct FYCRCheckpointAbility
+{
+    uint16 ClassIndex = 0;
+    uint8 Level = 1;
+};
+
+/**
+ * Snapshot of a live run, used by ContinueRun after a crash or suspend.
+ * Classes are stored once in ClassTable and referenced by index.
+ */
+struct YCR_API FYCRRunCheckpoint
+{
+    static constexpr float PositionQuantization = 10.0f;
+
+    FCurrentRunData RunData;
+
+    /** Current seed of every EYCRRandomStream */
+    TArray<int32> RandomStreamSeeds;
+
+    // Wave timeline
+    float RunTime = 0.0f;
+    bool bBossSpawned = false;
+
+    // Player
+    FVector Origin = FVector::ZeroVector;
+    float PlayerYaw = 0.0f;
+    int32 PlayerLevel = 1;
+    float CurrentExperience = 0.0f;
+    float ExperienceToNextLevel = 0.0f;
+    int32 CurrentGold = 0;
+
+    /** Base values of every UYCRAttributeSet attribute in declaration order */
+    TArray<float> AttributeBaseValues;
+    TArray<FYCRCheckpointAbility> Abilities;
+
+    // World
+    TArray<FSoftClassPath> ClassTable;
+    TArray<FYCRCheckpointEnemy> Enemies;
+    TArray<FYCRCheckpointGem> Gems;
+
+    /** Index of Class in ClassTable, adding it if needed */
+    uint16 AddClass(const UClass* Class);
+
+    void QuantizePosition(const FVector& Location, int16 OutPosition[3]) const;
+    FVector DequantizePosition(const int16 Position[3]) const;
+
+    void Serialize(FArchive& Ar);
+
+    /** Uncompressed Serialize output */
+    void WriteTo(TArray<uint8>& OutBytes) const;
+
+    /** Compress bytes produced by Serialize into a versioned blob (thread safe) */
+    static bool Encode(const TArray<uint8>& RawBytes, TArray<uint8>& OutBlob);
+
+    /** Decompress + deserialize a blob written by Encode */
+    static bool Decode(TConstArrayView<uint8> Blob, FYCRRunCheckpoint& OutCheckpoint);
+};
@@ -3,6 +3,7 @@
 #include "GameFramework/SaveGame.h"
 #include "Enums/EYCRCharacterClasses.h"
 #include "Enums/EYCRAchievementID.h"
+#include "Data/YCRSaveGameData.h"
 #include "YCRSaveGame.generated.h"
 
 USTRUCT(BlueprintType)
@@ -26,6 +27,54 @@ struct FYCRSavedCharacterData
     int32 HighestLevelReached = 0;
 };
 
+USTRUCT(BlueprintType)
+struct FCharacterUnlockData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    FName CharacterClass;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    int32 AdvancementLevel = 0;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    bool bIsUnlocked = false;
+};
+
+USTRUCT(BlueprintType)
+struct FCardSaveData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    FName CardID;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    int32 Count = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FAchievementSaveData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    FName AchievementID;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    bool bIsCompleted = false;
+};
+
+USTRUCT(BlueprintType)
+struct FMapProgressData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    int32 HighestLevelCompleted = 0;
+};
+
 UCLASS()
 class YCR_API UYCRSaveGame : public USaveGame
 {
@@ -34,6 +83,30 @@ class YCR_API UYCRSaveGame : public USaveGame
 public:
     UYCRSaveGame();
 
+    // Rebuilds the lookup indices after loading
+    virtual void Serialize(FArchive& Ar) override;
+
+    // Only written by version 1 saves, newer versions use FYCRSaveSchema (see EYCRSaveVersion)
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    int32 SaveVersion = 1;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    FDateTime LastSaveTime;
+
+    // Player progression written by UGameInstanceYCR
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    FPlayerProgressData SavedProgress;
+
+    // Last progression journal record folded into SavedProgress
+    UPROPERTY(SaveGame)
+    int64 JournalSequence = 0;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    FString SaveSlotName;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    int32 UserIndex = 0;
+
     // Current Character Data
     UPROPERTY(SaveGame, BlueprintReadOnly)
     FYCRSavedCharacterData CurrentCharacter;
@@ -52,10 +125,87 @@ public:
     UPROPERTY(SaveGame, BlueprintReadOnly)
     TArray<FName> UnlockedHairstyles;
 
+    // Collections - modify through the functions below so the indices stay valid
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    TArray<FCharacterUnlockData> UnlockedCharacters;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    TArray<FCardSaveData> CollectedCards;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    TArray<FAchievementSaveData> CompletedAchievements;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    TMap<FName, FMapProgressData> MapProgress;
+
+    // Statistics
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    float TotalPlayTime = 0.0f;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    int32 TotalRuns = 0;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    TMap<FName, int32> CharacterPlayCounts;
+
+    UPROPERTY(SaveGame, BlueprintReadOnly)
+    FName MostPlayedCharacter;
+
     // Helper Functions
     UFUNCTION(BlueprintCallable, Category = "Save Game")
     bool IsAchievementUnlocked(EYCRAchievementID AchievementID) const;
 
     UFUNCTION(BlueprintCallable, Category = "Save Game")
     void UnlockAchievement(EYCRAchievementID AchievementID);
-};
\ No newline at end of file
+
+    UFUNCTION(BlueprintPure, Category = "Save Game")
+    bool IsCharacterUnlocked(const FName& CharacterClass) const;
+
+    UFUNCTION(BlueprintPure, Category = "Save Game")
+    bool IsClassUnlocked(EYCRCharacterClasses CharacterClass) const;
+
+    UFUNCTION(BlueprintPure, Category = "Save Game")
+    int32 GetCharacterAdvancementLevel(const FName& CharacterClass) const;
+
+    UFUNCTION(BlueprintPure, Category = "Save Game")
+    int32 GetCardCount(const FName& CardID) const;
+
+    UFUNCTION(BlueprintPure, Category = "Save Game")
+    bool IsAchievementCompleted(const FName& AchievementID) const;
+
+    UFUNCTION(BlueprintPure, Category = "Save Game")
+    float GetCompletionPercentage() const { return CachedCompletionPercentage; }
+
+    UFUNCTION(BlueprintCallable, Category = "Save Game")
+    void UnlockCharacter(const FName& CharacterClass, int32 AdvancementLevel);
+
+    UFUNCTION(BlueprintCallable, Category = "Save Game")
+    void AddCard(const FName& CardID, int32 Count = 1);
+
+    UFUNCTION(BlueprintCallable, Category = "Save Game")
+    void CompleteAchievement(const FName& AchievementID);
+
+    UFUNCTION(BlueprintCallable, Category = "Save Game")
+    void SetMapLevelCompleted(const FName& MapName, int32 Level);
+
+    UFUNCTION(BlueprintCallable, Category = "Save Game")
+    void UpdatePlayStatistics(float SessionTime, const FName& PlayedCharacter);
+
+    // Call after editing the collections directly
+    void RebuildIndices();
+
+private:
+    // Lookup indices, rebuilt on load and kept in sync by the mutators above
+    TMap<FName, int32> CharacterSlots;
+    TStaticArray<int32, static_cast<int32>(EYCRCharacterClasses::MAX)> ClassSlots;
+    TMap<FName, int32> CardSlots;
+    TMap<FName, int32> AchievementSlots;
+    TBitArray<> UnlockedAchievementBits;
+
+    // Completion inputs, counted once and adjusted on mutation
+    int32 UnlockedCharacterCount = 0;
+    int32 CompletedMapLevels = 0;
+    float CachedCompletionPercentage = 0.0f;
+
+    void UpdateCompletionPercentage();
+};
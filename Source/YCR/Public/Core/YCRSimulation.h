@@ -0,0 +1,124 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "YCRSimulation.generated.h"
+
+class UWorld;
+
+/**
+ * Buckets the simulation summary reports game thread cost in
+ */
+UENUM()
+enum class EYCRSimulationCost : uint8
+{
+	RunLogic        UMETA(DisplayName = "Run Logic"),
+	Spawning        UMETA(DisplayName = "Spawning"),
+	AI              UMETA(DisplayName = "AI"),
+	Combat          UMETA(DisplayName = "Combat"),
+	Loot            UMETA(DisplayName = "Loot"),
+	Pickups         UMETA(DisplayName = "Pickups"),
+	Progression     UMETA(DisplayName = "Progression"),
+	Checkpoint      UMETA(DisplayName = "Checkpoint"),
+	Telemetry       UMETA(DisplayName = "Telemetry"),
+	Bot             UMETA(DisplayName = "Bot"),
+
+	MAX             UMETA(Hidden)
+};
+
+/**
+ * Headless soak-test mode, enabled with -YCRSimulate (usually together with -nullrhi -unattended).
+ * The engine steps at a fixed delta as fast as the machine allows, so run time no longer follows
+ * wall time. Presentation-only work is skipped and the process exits with a cost summary when
+ * the run ends instead of travelling back to the menu.
+ *
+ * Options: -YCRSimFPS=<steps per simulated second, default 30>
+ *          -YCRSimMaxTime=<run seconds after which the run is ended>
+ */
+class YCR_API FYCRSimulation
+{
+public:
+    static bool IsEnabled();
+
+    static float GetFixedDeltaTime();
+
+    /** Run time at which the simulation gives up on the run, DefaultTime unless overridden */
+    static float GetMaxRunTime(float DefaultTime);
+
+    /** Switch the engine to the fixed timestep and drop presentation for this world */
+    static void Begin(UWorld* World);
+
+    static void AddFrame() { FrameCount++; }
+
+    static void AddCost(EYCRSimulationCost Cost, uint64 Cycles)
+    {
+        Costs[static_cast<int32>(Cost)].Cycles += Cycles;
+        Costs[static_cast<int32>(Cost)].Calls++;
+    }
+
+    /** Log the summary and ask the engine to quit */
+    static void Finish(float RunTime, bool bVictory);
+
+private:
+    struct FCost
+    {
+        uint64 Cycles = 0;
+        int64 Calls = 0;
+    };
+
+    static TStaticArray<FCost, static_cast<int32>(EYCRSimulationCost::MAX)> Costs;
+    static int64 FrameCount;
+    static double StartWallTime;
+};
+
+/**
+ * Adds the game thread time of a scope to a simulation bucket.
+ * Scopes are exclusive: a nested scope pauses the enclosing one, so every cycle lands in exactly
+ * one bucket. Game thread only. Costs one branch when the simulation is off.
+ */
+struct YCR_API FYCRSimulationScope
+{
+    explicit FYCRSimulationScope(EYCRSimulationCost InCost)
+        : Cost(InCost)
+        , bActive(FYCRSimulation::IsEnabled())
+    {
+        if (bActive)
+        {
+            StartCycles = FPlatformTime::Cycles64();
+            Parent = Current;
+            if (Parent)
+            {
+                Parent->ElapsedCycles += StartCycles - Parent->StartCycles;
+            }
+            Current = this;
+        }
+    }
+
+    ~FYCRSimulationScope()
+    {
+        if (bActive)
+        {
+            const uint64 EndCycles = FPlatformTime::Cycles64();
+            FYCRSimulation::AddCost(Cost, ElapsedCycles + (EndCycles - StartCycles));
+            
+            // Resume the enclosing scope
+            Current = Parent;
+            if (Parent)
+            {
+                Parent->StartCycles = EndCycles;
+            }
+        }
+    }
+
+    FYCRSimulationScope(const FYCRSimulationScope&) = delete;
+    FYCRSimulationScope& operator=(const FYCRSimulationScope&) = delete;
+
+private:
+    EYCRSimulationCost Cost;
+    bool bActive;
+    uint64 StartCycles = 0;
+    uint64 ElapsedCycles = 0;
+    FYCRSimulationScope* Parent = nullptr;
+
+    /** Innermost open scope */
+    static FYCRSimulationScope* Current;
+};
@@ -13,8 +13,9 @@ struct FSpawnWaveData : public FTableRowBase
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	float StartTime = 0.0f;
 
+	/** Soft so late waves are streamed in ahead of time by UYCRPrewarmScheduler instead of loading with the map */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
-	TArray<TSubclassOf<class ACharacterBase>> MonsterClasses;
+	TArray<TSoftClassPtr<class ACharacterBase>> MonsterClasses;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	int32 SpawnCount = 10;
@@ -37,6 +38,8 @@ class YCR_API AYCRSpawnManager : public AActor
 public:
 	AYCRSpawnManager();
 
+	const UDataTable* GetSpawnWaveTable() const { return SpawnWaveTable; }
+
 protected:
 	virtual void BeginPlay() override;
 
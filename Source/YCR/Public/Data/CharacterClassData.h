@@ -27,11 +27,11 @@ struct FCharacterClassData : public FTableRowBase
 
     /** Job Class Enum Type */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General")
-    EJobClass JobClassType = EJobClass::Swordsman;
+    EYCRCharacterClasses JobClassType = EYCRCharacterClasses::Swordsman;
 
     /** Element-Affinität der Klasse */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General")
-    EElementType ClassElement = EElementType::Neutral;
+    EYCRElementType ClassElement = EYCRElementType::Neutral;
 
     /** Icon für UI */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
@@ -0,0 +1,67 @@
+﻿// Copyright YCR Project
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Enums/EYCRAchievementID.h"
+#include "YCRAchievementSet.generated.h"
+
+UENUM(BlueprintType)
+enum class EYCRAchievementComparison : uint8
+{
+    AtLeast     UMETA(DisplayName = ">="),
+    AtMost      UMETA(DisplayName = "<=")
+};
+
+/**
+ * Counter threshold that must hold for an achievement
+ */
+USTRUCT(BlueprintType)
+struct YCR_API FYCRAchievementCondition
+{
+    GENERATED_BODY()
+
+    /** Counter name, e.g. Run.MonstersKilled or Total.RunsWon (see FYCRAchievementTracker) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement")
+    FName Counter;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement")
+    EYCRAchievementComparison Comparison = EYCRAchievementComparison::AtLeast;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement")
+    int64 Threshold = 1;
+};
+
+/**
+ * Achievement unlocked once all of its conditions hold at the same time
+ */
+USTRUCT(BlueprintType)
+struct YCR_API FYCRAchievementDefinition
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement")
+    EYCRAchievementID AchievementID = EYCRAchievementID::None;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement")
+    TArray<FYCRAchievementCondition> Conditions;
+};
+
+/**
+ * Data-driven achievement definitions, compiled by FYCRAchievementTracker
+ */
+UCLASS(BlueprintType)
+class YCR_API UYCRAchievementSet : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UYCRAchievementSet();
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Achievement")
+    TArray<FYCRAchievementDefinition> Achievements;
+
+    /** Fill Achievements with the shipped achievements */
+    void ResetToDefaults();
+};
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "Data/YCRPrimaryAssetTypes.h"
 #include "YCRCharacterCreationData.generated.h"
 
 USTRUCT(BlueprintType)
@@ -11,7 +12,7 @@ struct FYCRHairstyleData
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	FName HairstyleID;
 
-	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (AssetBundles = "Menu"))
 	TSoftObjectPtr<USkeletalMesh> HairMesh;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
@@ -32,4 +33,9 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Character Creation")
 	int32 MinNameLength = 3;
+
+	virtual FPrimaryAssetId GetPrimaryAssetId() const override
+	{
+		return FPrimaryAssetId(FYCRPrimaryAssetTypes::CharacterCreation, GetFName());
+	}
 };
\ No newline at end of file
@@ -0,0 +1,78 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "YCRLevelCurves.generated.h"
+
+/**
+ * Level scaling curves baked by FYCRLevelCurves
+ */
+UENUM(BlueprintType)
+enum class EYCRLevelCurve : uint8
+{
+    MonsterHealth       UMETA(DisplayName = "Monster Health"),
+    MonsterAttack       UMETA(DisplayName = "Monster Attack"),
+    MonsterDefense      UMETA(DisplayName = "Monster Defense"),
+    MonsterExperience   UMETA(DisplayName = "Monster Experience Reward"),
+    MonsterGold         UMETA(DisplayName = "Monster Gold Reward"),
+
+    MAX                 UMETA(Hidden)
+};
+
+/**
+ * Level progression curves baked into lookup tables for levels 1 to MaxLevel.
+ * Built once on first use from the balance constants with plain multiplication instead of
+ * FMath::Pow, so every platform reads the same values.
+ */
+struct YCR_API FYCRLevelCurves
+{
+    static constexpr int32 MaxLevel = 100;
+
+    /** Player: experience for level 1 -> 2, each further level needs Round(previous * ExperienceGrowth) */
+    static constexpr double BaseExperienceToLevel = 100.0;
+    static constexpr double ExperienceGrowth = 1.2;
+
+    /** Monsters: stat = base * growth^(level - 1), similar to RO */
+    static constexpr double MonsterHealthGrowth = 1.15;
+    static constexpr double MonsterAttackGrowth = 1.08;
+    static constexpr double MonsterDefenseGrowth = 1.05;
+
+    /** Monsters: reward = base * (1 + level * per level) */
+    static constexpr double MonsterExperiencePerLevel = 0.1;
+    static constexpr double MonsterGoldPerLevel = 0.15;
+
+    /** Multiplier of Curve at Level (clamped to 1..MaxLevel) */
+    static float GetScale(EYCRLevelCurve Curve, int32 Level);
+
+    /** Experience needed to go from Level to Level + 1 */
+    static float GetExperienceToNextLevel(int32 Level);
+
+    /** Experience collected from level 1 with zero progress until Level is reached */
+    static double GetTotalExperienceForLevel(int32 Level);
+
+    /** Highest level (capped at MaxLevel) reached with TotalExperience collected since level 1 */
+    static int32 GetLevelForTotalExperience(double TotalExperience);
+};
+
+/**
+ * Blueprint access to the level curves (tooltips, level-up screens, bestiary)
+ */
+UCLASS()
+class YCR_API UYCRLevelCurveLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    UFUNCTION(BlueprintPure, Category = "YCR|Level Curves")
+    static float GetLevelScale(EYCRLevelCurve Curve, int32 Level) { return FYCRLevelCurves::GetScale(Curve, Level); }
+
+    UFUNCTION(BlueprintPure, Category = "YCR|Level Curves")
+    static float GetExperienceToNextLevel(int32 Level) { return FYCRLevelCurves::GetExperienceToNextLevel(Level); }
+
+    /** Float for Blueprint, exact up to level 100 */
+    UFUNCTION(BlueprintPure, Category = "YCR|Level Curves")
+    static float GetTotalExperienceForLevel(int32 Level) { return static_cast<float>(FYCRLevelCurves::GetTotalExperienceForLevel(Level)); }
+
+    UFUNCTION(BlueprintPure, Category = "YCR|Level Curves")
+    static int32 GetMaxLevel() { return FYCRLevelCurves::MaxLevel; }
+};
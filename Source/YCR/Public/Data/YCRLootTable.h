@@ -0,0 +1,238 @@
+﻿// Copyright YCR Project
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Enums/EYCRLootTypes.h"
+#include "Enums/EYCRMonsterTypes.h"
+#include "YCRLootTable.generated.h"
+
+/**
+ * What a single loot table entry produces when it is rolled
+ */
+UENUM(BlueprintType)
+enum class EYCRLootDropKind : uint8
+{
+    Nothing         UMETA(DisplayName = "Nothing"),
+    Coins           UMETA(DisplayName = "Coins"),
+    OutGameGem      UMETA(DisplayName = "Out-Game Gem"),
+    BuffScroll      UMETA(DisplayName = "Buff Scroll"),
+    RareItem        UMETA(DisplayName = "Rare Item")
+};
+
+/**
+ * One weighted outcome inside a loot group
+ */
+USTRUCT(BlueprintType)
+struct YCR_API FYCRLootEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot")
+    EYCRLootDropKind DropKind = EYCRLootDropKind::Nothing;
+
+    /** Relative weight inside the group (does not need to sum to 100) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot", meta = (ClampMin = "0.0"))
+    float Weight = 1.0f;
+
+    /** Amount range, rolled uniformly (coins, stack size) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot", meta = (ClampMin = "0"))
+    int32 MinAmount = 1;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot", meta = (ClampMin = "0"))
+    int32 MaxAmount = 1;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot", meta = (EditCondition = "DropKind == EYCRLootDropKind::OutGameGem"))
+    EYCRGemColor GemColor = EYCRGemColor::White;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot", meta = (EditCondition = "DropKind == EYCRLootDropKind::BuffScroll"))
+    EYCRBuffType BuffType = EYCRBuffType::Frenzy;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot", meta = (EditCondition = "DropKind == EYCRLootDropKind::RareItem"))
+    FName ItemID;
+};
+
+/**
+ * Group of mutually exclusive outcomes - exactly one entry is picked per roll.
+ * Add a "Nothing" entry to express a drop chance.
+ */
+USTRUCT(BlueprintType)
+struct YCR_API FYCRLootGroup
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot")
+    FName GroupName;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot", meta = (ClampMin = "0"))
+    int32 RollCount = 1;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot")
+    TArray<FYCRLootEntry> Entries;
+};
+
+/**
+ * Loot definition for one monster type
+ */
+USTRUCT(BlueprintType)
+struct YCR_API FYCRMonsterLootTable
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot")
+    EYCRMonsterType MonsterType = EYCRMonsterType::Normal;
+
+    /** Experience = BaseExperience * ExpMultiplier * MonsterLevel */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot", meta = (ClampMin = "0.0"))
+    float ExpMultiplier = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot")
+    TArray<FYCRLootGroup> Groups;
+};
+
+/**
+ * Result of a single loot roll
+ */
+USTRUCT(BlueprintType)
+struct YCR_API FYCRLootDrop
+{
+    GENERATED_BODY()
+
+    /** Index of the request in a batched roll (0 for single rolls) */
+    UPROPERTY(BlueprintReadOnly, Category = "Loot")
+    int32 RequestIndex = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Loot")
+    EYCRLootDropKind DropKind = EYCRLootDropKind::Nothing;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Loot")
+    int32 Amount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Loot")
+    EYCRGemColor GemColor = EYCRGemColor::White;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Loot")
+    EYCRBuffType BuffType = EYCRBuffType::Frenzy;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Loot")
+    FName ItemID;
+};
+
+/**
+ * One kill to roll loot for (used for batched rolls in multi-kill frames)
+ */
+USTRUCT(BlueprintType)
+struct YCR_API FYCRLootRollRequest
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, Category = "Loot")
+    EYCRMonsterType MonsterType = EYCRMonsterType::Normal;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Loot")
+    int32 MonsterLevel = 1;
+};
+
+/**
+ * Walker/Vose alias table - samples a discrete distribution in O(1)
+ * independent of the number of outcomes.
+ */
+struct YCR_API FYCRAliasSampler
+{
+    /** Build from non-negative weights. All-zero weights produce an empty sampler. */
+    void Build(TConstArrayView<float> Weights);
+
+    /** Pick an outcome index from a uniform value in [0, 1) */
+    FORCEINLINE int32 Sample(float Uniform) const
+    {
+        const int32 Num = Probability.Num();
+        const float Scaled = Uniform * Num;
+        const int32 Column = FMath::Min(FMath::FloorToInt32(Scaled), Num - 1);
+        return (Scaled - Column) < Probability[Column] ? Column : Alias[Column];
+    }
+
+    bool IsEmpty() const { return Probability.IsEmpty(); }
+
+private:
+    TArray<float> Probability;
+    TArray<int32> Alias;
+};
+
+/**
+ * Data-driven loot table for a map.
+ * Compiled into alias samplers on load so every roll costs O(1) per group.
+ */
+UCLASS(BlueprintType)
+class YCR_API UYCRLootTable : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UYCRLootTable();
+
+    virtual void PostLoad() override;
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+    /** Map this table belongs to (informational, tables are assigned per game mode) */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot")
+    FName MapName;
+
+    /** Base experience before type multiplier and monster level */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot", meta = (ClampMin = "0"))
+    int32 BaseExperience = 10;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Loot")
+    TArray<FYCRMonsterLootTable> MonsterTables;
+
+    /** Rebuild the alias samplers from MonsterTables */
+    UFUNCTION(BlueprintCallable, Category = "Loot")
+    void CompileTables();
+
+    /** Roll all groups for one kill, appending to OutDrops */
+    void RollLoot(const FYCRLootRollRequest& Request, const FRandomStream& Stream, TArray<FYCRLootDrop>& OutDrops,
+        int32 RequestIndex = 0) const;
+
+    /** Roll loot for every kill of a frame in one pass */
+    void RollLootBatch(TConstArrayView<FYCRLootRollRequest> Requests, const FRandomStream& Stream,
+        TArray<FYCRLootDrop>& OutDrops) const;
+
+    UFUNCTION(BlueprintPure, Category = "Loot")
+    int32 GetExperienceFor(EYCRMonsterType MonsterType, int32 MonsterLevel) const;
+
+    UFUNCTION(BlueprintPure, Category = "Loot")
+    float GetExpMultiplier(EYCRMonsterType MonsterType) const;
+
+    /** Summed probability (0-100) of the given drop kind across one roll of every group */
+    UFUNCTION(BlueprintPure, Category = "Loot")
+    float GetDropChance(EYCRMonsterType MonsterType, EYCRLootDropKind DropKind) const;
+
+    /** Gem colour of the first out-game gem entry for this monster type */
+    UFUNCTION(BlueprintPure, Category = "Loot")
+    EYCRGemColor GetGemColor(EYCRMonsterType MonsterType) const;
+
+    /** Fill MonsterTables with the shipped balance values */
+    void ResetToDefaults();
+
+private:
+    struct FCompiledGroup
+    {
+        FYCRAliasSampler Sampler;
+        TArray<FYCRLootEntry> Entries;
+        float TotalWeight = 0.0f;
+        int32 RollCount = 1;
+    };
+
+    struct FCompiledMonsterLoot
+    {
+        float ExpMultiplier = 1.0f;
+        TArray<FCompiledGroup> Groups;
+    };
+
+    /** Indexed by EYCRMonsterType */
+    TStaticArray<FCompiledMonsterLoot, static_cast<int32>(EYCRMonsterType::MAX)> CompiledLoot;
+
+    const FCompiledMonsterLoot& GetCompiled(EYCRMonsterType MonsterType) const;
+};
@@ -0,0 +1,45 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "YCRMapData.generated.h"
+
+class AEnemyBase;
+class UYCRLootTable;
+class UTexture2D;
+
+/**
+ * Content of one map (all of its sub-levels), grouped into asset bundles
+ * so the menu can stream a run's content in before the level is opened.
+ */
+UCLASS(BlueprintType)
+class YCR_API UYCRMapData : public UPrimaryDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    /** Base name of the map levels (e.g. VerdantPlains for VerdantPlains_L1..L5), also the primary asset name */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Map")
+    FName MapName;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Map")
+    FText DisplayName;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Map", meta = (AssetBundles = "Menu"))
+    TSoftObjectPtr<UTexture2D> PreviewImage;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Map", meta = (AssetBundles = "InRun"))
+    TSoftObjectPtr<UYCRLootTable> LootTable;
+
+    /** Every enemy the map's waves can spawn */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Map", meta = (AssetBundles = "InRun"))
+    TArray<TSoftClassPtr<AEnemyBase>> EnemyClasses;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Map", meta = (AssetBundles = "Boss"))
+    TSoftClassPtr<AEnemyBase> BossClass;
+
+    virtual FPrimaryAssetId GetPrimaryAssetId() const override;
+
+    /** Id of the map data for a map name, without loading anything */
+    static FPrimaryAssetId MakePrimaryAssetId(FName InMapName);
+};
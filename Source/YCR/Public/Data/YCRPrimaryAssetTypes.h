@@ -0,0 +1,27 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/PrimaryAssetId.h"
+
+/**
+ * Primary asset types registered in DefaultGame.ini (AssetManagerSettings)
+ */
+struct YCR_API FYCRPrimaryAssetTypes
+{
+    static const FPrimaryAssetType CharacterCreation;
+    static const FPrimaryAssetType Gems;
+    static const FPrimaryAssetType Map;
+};
+
+/**
+ * Asset bundles used by the YCR data assets.
+ * Menu   - shown while in menus (previews, hairstyles)
+ * InRun  - needed from the first frame of a run
+ * Boss   - only needed once the boss is about to spawn
+ */
+struct YCR_API FYCRAssetBundles
+{
+    static const FName Menu;
+    static const FName InRun;
+    static const FName Boss;
+};
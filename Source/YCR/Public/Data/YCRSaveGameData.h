@@ -31,6 +31,10 @@ struct YCR_API FPlayerProgressData
     UPROPERTY(BlueprintReadWrite, SaveGame)
     TSet<FString> UnlockedAchievements;
 
+    /** Collected cards and how many copies of each */
+    UPROPERTY(BlueprintReadWrite, SaveGame)
+    TMap<FName, int32> CollectedCards;
+
     /** Lifetime statistics */
     UPROPERTY(BlueprintReadWrite, SaveGame)
     int32 TotalRunsPlayed = 0;
@@ -97,6 +101,14 @@ struct YCR_API FCurrentRunData
     UPROPERTY(BlueprintReadWrite)
     int32 ExperienceCollected = 0;
 
+    /** Seed all per-system random streams of this run are derived from */
+    UPROPERTY(BlueprintReadWrite)
+    int32 RunSeed = 0;
+
+    /** Wall clock time the run was started */
+    UPROPERTY(BlueprintReadWrite)
+    FDateTime RunStartTime;
+
     /** Reset all data for new run */
     void Reset()
     {
@@ -0,0 +1,68 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "Data/YCRSaveGameData.h"
+
+/**
+ * Save file versions. Append new versions and a matching migration step,
+ * never change how an existing version is decoded.
+ */
+enum class EYCRSaveVersion : uint16
+{
+    /** UYCRSaveGame with tagged property serialization of FPlayerProgressData */
+    LegacyTagged = 1,
+
+    /** Compact binary profile: class/achievement bitsets, packed integers */
+    CompactBinary = 2,
+
+    LatestPlusOne,
+    Latest = LatestPlusOne - 1
+};
+
+/**
+ * Decoded save slot contents
+ */
+struct YCR_API FYCRSaveProfile
+{
+    FPlayerProgressData Progress;
+
+    /** Last progression journal record folded into Progress */
+    int64 JournalSequence = 0;
+
+    FDateTime LastSaveTime;
+
+    /** Version the data was stored with before migration */
+    EYCRSaveVersion LoadedVersion = EYCRSaveVersion::Latest;
+};
+
+/**
+ * Reads and writes the save slot.
+ *
+ * Files are decoded with the decoder of their stored version and then
+ * upgraded one version at a time until they reach EYCRSaveVersion::Latest,
+ * so a profile written by any released build keeps loading.
+ */
+struct YCR_API FYCRSaveSchema
+{
+    /** Target for decoding + migrating a maxed-out profile (see YCR.Save.Benchmark) */
+    static constexpr double LoadBudgetMs = 1.0;
+
+    /** Encode Profile with the latest version */
+    static void Write(const FYCRSaveProfile& Profile, TArray<uint8>& OutBytes);
+
+    /**
+     * Decode any supported version and migrate it to the latest
+     * @return false for corrupt files and files written by a newer build
+     */
+    static bool Read(TConstArrayView<uint8> Bytes, FYCRSaveProfile& OutProfile);
+
+    /** Achievement IDs as used by UGameInstanceYCR, indexed by EYCRAchievementID */
+    static const FString& GetAchievementName(uint8 AchievementID);
+    static int32 FindAchievementID(const FString& AchievementName);
+
+private:
+    static bool ReadLegacyTagged(TConstArrayView<uint8> Bytes, FYCRSaveProfile& OutProfile);
+    static bool ReadCompactBinary(FArchive& Ar, FYCRSaveProfile& OutProfile);
+
+    static void MigrateLegacyTaggedToCompactBinary(FYCRSaveProfile& Profile);
+};
@@ -6,6 +6,7 @@
 #include "Enums/EYCRMonsterTypes.h"
 #include "Enums/EYCRSize.h"
 #include "Enums/EYCRElements.h"
+#include "Data/YCRLevelCurves.h"
 #include "EnemyBase.generated.h"
 
 UCLASS()
@@ -39,6 +40,10 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy|Stats")
     float AttackRange;
 
+    // Level curves are baked up to FYCRLevelCurves::MaxLevel, higher levels scale like it
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy|Stats", meta = (ClampMin = "1", ClampMax = "100"))
+    int32 MonsterLevel = 1;
+
     // Monster Size (affects stats and knockback)
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Enemy|Stats")
     EYCRSize MonsterSize;
@@ -65,4 +70,9 @@ protected:
     // Apply monster-specific stat modifiers
     void ApplyMonsterTypeModifiers();
     void ApplySizeModifiers();
+
+    // Level scaling from the baked level curves
+    float CalculateStatForLevel(float BaseStat, EYCRLevelCurve Curve) const;
+    int32 CalculateExperienceReward() const;
+    int32 CalculateGoldReward() const;
 };
\ No newline at end of file
@@ -9,5 +9,12 @@ enum class EYCRAchievementID : uint8
 	FirstBlood      UMETA(DisplayName = "First Blood"),
 	BossKiller      UMETA(DisplayName = "Boss Killer"),
 	GoldCollector   UMETA(DisplayName = "Rich"),
-	// ... weitere Achievements
+	MonsterHunter   UMETA(DisplayName = "Monster Hunter"),
+	EliteSlayer     UMETA(DisplayName = "Elite Slayer"),
+	Speedrunner     UMETA(DisplayName = "Speedrunner"),
+	Exterminator    UMETA(DisplayName = "Exterminator"),
+	Veteran         UMETA(DisplayName = "Veteran"),
+	// ... weitere Achievements (nur hinten anfügen, Werte werden gespeichert)
+
+	MAX             UMETA(Hidden)
 };
\ No newline at end of file
@@ -17,4 +17,6 @@ enum class EYCRMonsterType : uint8
 	MiniBoss    UMETA(DisplayName = "Mini Boss"),
 	Boss        UMETA(DisplayName = "Boss"),
 	Special     UMETA(DisplayName = "Special"),     // Event monsters
+
+	MAX         UMETA(Hidden)
 };
\ No newline at end of file
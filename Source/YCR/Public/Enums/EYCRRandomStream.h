@@ -0,0 +1,19 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "EYCRRandomStream.generated.h"
+
+/**
+ * Gameplay systems that own a seeded random stream.
+ * Each stream is derived from the run seed so systems do not disturb each other's sequences.
+ */
+UENUM(BlueprintType)
+enum class EYCRRandomStream : uint8
+{
+	Loot            UMETA(DisplayName = "Loot"),
+	GemScatter      UMETA(DisplayName = "Gem Scatter"),
+	BossPlacement   UMETA(DisplayName = "Boss Placement"),
+	GoldVariance    UMETA(DisplayName = "Gold Variance"),
+
+	MAX             UMETA(Hidden)
+};